@@ -29,6 +29,7 @@
 #include <brayns/common/light/Light.h>
 #include <brayns/common/log.h>
 #include <brayns/common/mathTypes.h>
+#include <brayns/common/simulation/AbstractSimulationHandler.h>
 #include <brayns/common/utils/DynamicLib.h>
 #include <brayns/common/utils/stringUtils.h>
 
@@ -56,6 +57,7 @@
 
 #include <brayns/pluginapi/Plugin.h>
 
+#include <cmath>
 #include <thread>
 
 namespace
@@ -66,6 +68,11 @@ const brayns::Vector3f DEFAULT_SUN_DIRECTION = {1.f, -1.f, -1.f};
 const brayns::Vector3f DEFAULT_SUN_COLOR = {0.9f, 0.9f, 0.9f};
 constexpr double DEFAULT_SUN_ANGULAR_DIAMETER = 0.53;
 constexpr double DEFAULT_SUN_INTENSITY = 1.0;
+
+// Upper bound for the subsampling factor chosen to meet the target frame time
+constexpr size_t MAX_ADAPTIVE_SUBSAMPLING = 8;
+// Weight of the history in the moving average of the render times
+constexpr double FRAME_TIME_SMOOTHING = 0.75;
 } // namespace
 
 namespace brayns
@@ -151,6 +158,7 @@ struct Brayns::Impl : public PluginAPI
         scene.commit();
 
         _engine->getStatistics().setSceneSizeInBytes(scene.getSizeInBytes());
+        _updateSimulationStatistics(scene);
 
         _parametersManager.getAnimationParameters().update();
 
@@ -180,6 +188,7 @@ struct Brayns::Impl : public PluginAPI
             lightManager.isModified())
         {
             _engine->clearFrameBuffers();
+            _adaptSubsampling(rp);
         }
 
         _parametersManager.resetModified();
@@ -195,11 +204,33 @@ struct Brayns::Impl : public PluginAPI
     {
         std::lock_guard<std::mutex> lock{_renderMutex};
 
+        // subsampled frames are normalized to the full resolution render time
+        double renderedPixels = 0.;
+        double fullPixels = 0.;
+        for (auto frameBuffer : _frameBuffers)
+        {
+            const auto size = frameBuffer->getSize();
+            const auto& frameSize = frameBuffer->getFrameSize();
+            renderedPixels += double(size.x) * size.y;
+            fullPixels += double(frameSize.x) * frameSize.y;
+        }
+
         _renderTimer.start();
         _engine->render();
         _renderTimer.stop();
         _lastFPS = _renderTimer.perSecondSmoothed();
 
+        if (renderedPixels > 0.)
+        {
+            const auto fullFrameTime = _renderTimer.microseconds() / 1000. *
+                                       fullPixels / renderedPixels;
+            _fullFrameTime = _fullFrameTime > 0.
+                                 ? FRAME_TIME_SMOOTHING * _fullFrameTime +
+                                       (1. - FRAME_TIME_SMOOTHING) *
+                                           fullFrameTime
+                                 : fullFrameTime;
+        }
+
         const auto& params = _parametersManager.getApplicationParameters();
         const auto fps = params.getMaxRenderFPS();
         const auto delta = _lastFPS - fps;
@@ -236,6 +267,28 @@ struct Brayns::Impl : public PluginAPI
         return commit();
     }
 
+    /**
+     * Pick the subsampling factor of the first frame after a change such that
+     * its render time fits into the target frame time. The render time scales
+     * with the number of pixels, so the factor is the square root of the ratio
+     * between the averaged full resolution render time and the target.
+     * Accumulation frames are rendered at full resolution by the frame buffer.
+     */
+    void _adaptSubsampling(const RenderingParameters& rp)
+    {
+        const auto targetFrameTime = rp.getTargetFrameTime();
+        if (targetFrameTime <= 0. || _fullFrameTime <= 0.)
+            return;
+
+        const auto factor =
+            size_t(std::ceil(std::sqrt(_fullFrameTime / targetFrameTime)));
+        const auto subsampling =
+            std::max(size_t(rp.getSubsampling()),
+                     std::min(factor, MAX_ADAPTIVE_SUBSAMPLING));
+        for (auto frameBuffer : _frameBuffers)
+            frameBuffer->setSubsampling(subsampling);
+    }
+
     void _updateRenderOutput(RenderOutput& renderOutput)
     {
         FrameBuffer& frameBuffer = _engine->getFrameBuffer();
@@ -286,6 +339,30 @@ struct Brayns::Impl : public PluginAPI
     Scene& getScene() final { return _engine->getScene(); }
 
 private:
+    void _updateSimulationStatistics(const Scene& scene)
+    {
+        FramePrefetcher::Counters total;
+        {
+            auto lock = scene.acquireReadAccess();
+            for (const auto& modelDescriptor : scene.getModelDescriptors())
+            {
+                const auto handler =
+                    modelDescriptor->getModel().getSimulationHandler();
+                if (!handler)
+                    continue;
+                const auto counters = handler->getPrefetchCounters();
+                total.hits += counters.hits;
+                total.misses += counters.misses;
+                total.stalls += counters.stalls;
+            }
+        }
+
+        auto& statistics = _engine->getStatistics();
+        statistics.setSimulationCacheHits(total.hits);
+        statistics.setSimulationCacheMisses(total.misses);
+        statistics.setSimulationStalls(total.stalls);
+    }
+
     void _createEngine()
     {
         auto engineName =
@@ -787,6 +864,8 @@ private:
 
     Timer _renderTimer;
     std::atomic<double> _lastFPS;
+    // moving average of the render time in ms at full resolution
+    double _fullFrameTime{0.};
 
     std::shared_ptr<ActionInterface> _actionInterface;
     std::shared_ptr<DirectionalLight> _sunLight;
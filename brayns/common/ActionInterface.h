@@ -118,6 +118,28 @@ public:
         });
     }
 
+    /**
+     * Register an action with a parameter, an optional binary attachment and
+     * no return value. The attachment carries bulk numeric data which is too
+     * costly to encode as JSON arrays. It is sent by the client as binary
+     * message(s) announced by a 'chunk' notification with 'attachment' set to
+     * true, and is referenced by the 'chunks_id' member of the parameter. The
+     * attachment is empty if the parameter does not reference one.
+     */
+    template <typename Params>
+    void registerBinaryNotification(
+        const std::string& name,
+        const std::function<void(Params, const uint8_ts&)>& action)
+    {
+        _registerBinaryNotification(name, [action](const std::string& param,
+                                                   const uint8_ts& data) {
+            Params params;
+            if (!from_json(params, param))
+                throw std::runtime_error("from_json failed");
+            action(params, data);
+        });
+    }
+
     /** Register an action with a parameter and a return value. */
     template <typename Params, typename RetVal>
     void registerRequest(const std::string& name,
@@ -144,11 +166,17 @@ protected:
     using RetFunc = std::function<std::string()>;
     using ParamFunc = std::function<void(std::string)>;
     using VoidFunc = std::function<void()>;
+    using BinaryParamFunc =
+        std::function<void(std::string, const uint8_ts&)>;
 
 private:
     virtual void _registerRequest(const std::string&, const RetParamFunc&) {}
     virtual void _registerRequest(const std::string&, const RetFunc&) {}
     virtual void _registerNotification(const std::string&, const ParamFunc&) {}
     virtual void _registerNotification(const std::string&, const VoidFunc&) {}
+    virtual void _registerBinaryNotification(const std::string&,
+                                             const BinaryParamFunc&)
+    {
+    }
 };
 }
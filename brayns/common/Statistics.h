@@ -31,17 +31,52 @@ namespace brayns
 class Statistics : public BaseObject
 {
 public:
+    /** Render frames per second */
     double getFPS() const { return _fps; }
     void setFPS(const double fps) { _updateValue(_fps, fps); }
+    /** Frames per second written to the video stream, if enabled */
+    double getEncoderFPS() const { return _encoderFPS; }
+    void setEncoderFPS(const double fps) { _updateValue(_encoderFPS, fps); }
+    /** Rendered frames dropped because the stream encoder was still busy or
+     * the stream fps was exceeded */
+    size_t getDroppedFrames() const { return _droppedFrames; }
+    void setDroppedFrames(const size_t droppedFrames)
+    {
+        _updateValue(_droppedFrames, droppedFrames);
+    }
     size_t getSceneSizeInBytes() const { return _sceneSizeInBytes; }
     void setSceneSizeInBytes(const size_t sceneSizeInBytes)
     {
         _updateValue(_sceneSizeInBytes, sceneSizeInBytes);
     }
+    /** Simulation frames which were read ahead when the animation needed them */
+    size_t getSimulationCacheHits() const { return _simulationCacheHits; }
+    void setSimulationCacheHits(const size_t hits)
+    {
+        _updateValue(_simulationCacheHits, hits);
+    }
+    /** Simulation frames which were not read ahead when the animation needed
+     * them */
+    size_t getSimulationCacheMisses() const { return _simulationCacheMisses; }
+    void setSimulationCacheMisses(const size_t misses)
+    {
+        _updateValue(_simulationCacheMisses, misses);
+    }
+    /** Frames where the animation had to wait for simulation data */
+    size_t getSimulationStalls() const { return _simulationStalls; }
+    void setSimulationStalls(const size_t stalls)
+    {
+        _updateValue(_simulationStalls, stalls);
+    }
 
 private:
     double _fps{0.0};
+    double _encoderFPS{0.0};
+    size_t _droppedFrames{0};
     size_t _sceneSizeInBytes{0};
+    size_t _simulationCacheHits{0};
+    size_t _simulationCacheMisses{0};
+    size_t _simulationStalls{0};
 
     SERIALIZATION_FRIEND(Statistics)
 };
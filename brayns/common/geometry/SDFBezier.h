@@ -129,4 +129,64 @@ inline Boxd bezierBounds(const SDFBezier& bc)
     return bounds;
 }
 
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * Distance of the inner control points from the chord between the end points,
+ * which is zero for a straight, uniformly parametrized curve.
+ */
+inline float bezierFlatness(const SDFBezier& bc)
+{
+    const Vector3f c0 = (2.f * bc.p0 + bc.p1) / 3.f;
+    const Vector3f c1 = (bc.p0 + 2.f * bc.p1) / 3.f;
+    return glm::max(glm::length(bc.c0 - c0), glm::length(bc.c1 - c1));
+}
+
+//////////////////////////////////////////////////////////////////////
+
+/**
+ * Splits the curve in two halves at t = 0.5 (de Casteljau). The radius is
+ * linear in t, so both halves describe exactly the same tube.
+ */
+inline void splitBezier(const SDFBezier& bc, SDFBezier& left, SDFBezier& right)
+{
+    const Vector3f p01 = (bc.p0 + bc.c0) * 0.5f;
+    const Vector3f p12 = (bc.c0 + bc.c1) * 0.5f;
+    const Vector3f p23 = (bc.c1 + bc.p1) * 0.5f;
+    const Vector3f p012 = (p01 + p12) * 0.5f;
+    const Vector3f p123 = (p12 + p23) * 0.5f;
+    const Vector3f mid = (p012 + p123) * 0.5f;
+    const float rMid = (bc.r0 + bc.r1) * 0.5f;
+
+    left = {bc.userData, bc.p0, p01, bc.r0, mid, p012, rMid};
+    right = {bc.userData, mid, p123, rMid, bc.p1, p23, bc.r1};
+}
+
+//////////////////////////////////////////////////////////////////////
+
+constexpr size_t MAX_BEZIER_SUBDIVISION_DEPTH = 4;
+
+/**
+ * Appends the curve to 'pieces', recursively split until the flatness of each
+ * piece is below 'tolerance' or MAX_BEZIER_SUBDIVISION_DEPTH is reached. The
+ * bounds of the pieces enclose much less empty space than the bounds of a long
+ * curved segment, which lets the BVH cull more rays before the costly distance
+ * function is evaluated.
+ */
+inline void subdivideBezier(const SDFBezier& bc, const float tolerance,
+                            SDFBeziers& pieces, const size_t depth = 0)
+{
+    if (depth >= MAX_BEZIER_SUBDIVISION_DEPTH ||
+        bezierFlatness(bc) <= tolerance)
+    {
+        pieces.push_back(bc);
+        return;
+    }
+
+    SDFBezier left, right;
+    splitBezier(bc, left, right);
+    subdivideBezier(left, tolerance, pieces, depth + 1);
+    subdivideBezier(right, tolerance, pieces, depth + 1);
+}
+
 } // namespace brayns
\ No newline at end of file
@@ -0,0 +1,91 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "BlobStream.h"
+
+#include <async++.h>
+
+namespace brayns
+{
+BlobStream::BlobStream(const std::string& type, const std::string& name,
+                       const size_t size, const size_t capacity)
+    : _type(type)
+    , _name(name)
+    , _size(size)
+    , _capacity(capacity)
+{
+}
+
+bool BlobStream::append(const std::string& chunk)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [&] {
+        return _cancelled || _bufferedBytes == 0 ||
+               _bufferedBytes + chunk.size() <= _capacity;
+    });
+    if (_cancelled)
+        return false;
+    if (chunk.empty())
+        return true;
+
+    _chunks.push_back(chunk);
+    _bufferedBytes += chunk.size();
+    _receivedBytes += chunk.size();
+    _condition.notify_all();
+    return true;
+}
+
+void BlobStream::cancel()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cancelled = true;
+    _chunks.clear();
+    _bufferedBytes = 0;
+    _condition.notify_all();
+}
+
+uint8_ts BlobStream::readAll()
+{
+    uint8_ts data(_size - getReadBytes());
+    const auto size = sgetn(reinterpret_cast<char*>(data.data()), data.size());
+    data.resize(size);
+    return data;
+}
+
+BlobStream::int_type BlobStream::underflow()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [&] {
+        return _cancelled || !_chunks.empty() || _receivedBytes >= _size;
+    });
+    if (_cancelled)
+        throw async::task_canceled();
+    if (_chunks.empty())
+        return traits_type::eof();
+
+    _current = std::move(_chunks.front());
+    _chunks.pop_front();
+    _bufferedBytes -= _current.size();
+    _readBytes += _current.size();
+    _condition.notify_all();
+
+    setg(&_current[0], &_current[0], &_current[0] + _current.size());
+    return traits_type::to_int_type(_current[0]);
+}
+}
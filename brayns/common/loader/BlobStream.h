@@ -0,0 +1,92 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/common/types.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <streambuf>
+
+namespace brayns
+{
+/**
+ * A stream buffer for blobs which are received in chunks, e.g. uploads, so
+ * loaders can parse the data while it arrives instead of waiting for the
+ * complete blob.
+ *
+ * The receiver appends chunks from one thread while the loader reads from
+ * another, either directly or via a std::istream. The amount of received but
+ * not yet read data is bounded by the given capacity; append() waits for the
+ * reader to free enough capacity, which stops the receiver from reading the
+ * socket and so slows down the sender. The stream ends after the announced size
+ * has been received. Reading from a cancelled stream throws
+ * async::task_canceled.
+ */
+class BlobStream : public std::streambuf
+{
+public:
+    BlobStream(const std::string& type, const std::string& name,
+               size_t size, size_t capacity);
+
+    /** @return file extension or type of the blob */
+    const std::string& getType() const { return _type; }
+    /** @return name of the blob */
+    const std::string& getName() const { return _name; }
+    /** @return the total size in bytes of the blob */
+    size_t getSize() const { return _size; }
+    /** @return the number of bytes consumed so far; only for the reader */
+    size_t getReadBytes() const { return _readBytes - (egptr() - gptr()); }
+
+    /**
+     * Append a chunk for the reader, waiting until it fits into the remaining
+     * capacity. A chunk bigger than the capacity is appended once all buffered
+     * data has been read.
+     *
+     * @return false if the stream was cancelled, true otherwise
+     */
+    bool append(const std::string& chunk);
+
+    /** Stop the stream, unblocks both the receiver and the reader. */
+    void cancel();
+
+    /** Read the remaining data of the stream into one buffer. */
+    uint8_ts readAll();
+
+protected:
+    int_type underflow() final;
+
+private:
+    const std::string _type;
+    const std::string _name;
+    const size_t _size;
+    const size_t _capacity;
+
+    std::deque<std::string> _chunks;
+    std::string _current;
+    size_t _bufferedBytes{0};
+    size_t _receivedBytes{0};
+    size_t _readBytes{0};
+    bool _cancelled{false};
+    std::mutex _mutex;
+    std::condition_variable _condition;
+};
+}
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <brayns/common/PropertyMap.h>
+#include <brayns/common/loader/BlobStream.h>
 #include <brayns/common/types.h>
 
 #include <functional>
@@ -106,6 +107,26 @@ public:
         Blob&& blob, const LoaderProgress& callback,
         const PropertyMap& properties) const = 0;
 
+    /**
+     * Import the data from the stream of a blob which is still being received
+     * and return the created model. Loaders which can parse incrementally
+     * override this to start before the complete blob has arrived; the default
+     * reads the whole stream and uses importFromBlob().
+     *
+     * @param stream the stream of the blob containing the data to import
+     * @param callback Callback for loader progress
+     * @param properties Properties used for loading
+     * @return the model that has been created by the loader
+     */
+    virtual ModelDescriptorPtr importFromStream(
+        BlobStream& stream, const LoaderProgress& callback,
+        const PropertyMap& properties) const
+    {
+        return importFromBlob({stream.getType(), stream.getName(),
+                               stream.readAll()},
+                              callback, properties);
+    }
+
     /**
      * Import the data from the given file and return the created model.
      *
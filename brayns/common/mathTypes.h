@@ -141,6 +141,7 @@ using Vector3ui = glm::vec<3, uint32_t>;
 using Vector2f = glm::vec2;
 using Vector3f = glm::vec3;
 using Vector4f = glm::vec4;
+typedef std::vector<Vector2f> Vector2fs;
 typedef std::vector<Vector3f> Vector3fs;
 typedef std::vector<Vector4f> Vector4fs;
 
@@ -23,6 +23,12 @@ namespace brayns
 {
 AbstractSimulationHandler::~AbstractSimulationHandler() = default;
 
+AbstractSimulationHandler::AbstractSimulationHandler(
+    const AbstractSimulationHandler& rhs)
+{
+    *this = rhs;
+}
+
 AbstractSimulationHandler& AbstractSimulationHandler::operator=(
     const AbstractSimulationHandler& rhs)
 {
@@ -34,13 +40,114 @@ AbstractSimulationHandler& AbstractSimulationHandler::operator=(
     _frameSize = rhs._frameSize;
     _dt = rhs._dt;
     _unit = rhs._unit;
-    _frameData = rhs._frameData;
+    _frameData = rhs._handedOverFrameData ? *rhs._handedOverFrameData
+                                          : rhs._frameData;
+    _handedOverFrameData = nullptr;
+    _frameCache = rhs._frameCache;
 
     return *this;
 }
 
+bool AbstractSimulationHandler::takeFrameData(const uint32_t frame,
+                                              floats& buffer)
+{
+    const auto data = static_cast<const float*>(getFrameData(frame));
+    if (!data)
+        return false;
+    buffer.assign(data, data + _frameSize);
+    return true;
+}
+
+bool AbstractSimulationHandler::selectValues(const uint32_t frame,
+                                             const float value,
+                                             const float epsilon,
+                                             uint8_ts& mask)
+{
+    auto data = static_cast<const float*>(getFrameData(frame));
+    if (!data || !isReady())
+    {
+        // the frame is loaded asynchronously, wait for it instead of
+        // selecting from the previous frame
+        waitReady();
+        data = static_cast<const float*>(getFrameData(frame));
+        if (!data || !isReady())
+            return false;
+    }
+    selectFrameValues(data, _frameSize, value, epsilon, mask);
+    return true;
+}
+
 uint32_t AbstractSimulationHandler::_getBoundedFrame(const uint32_t frame) const
 {
     return _nbFrames == 0 ? frame : frame % _nbFrames;
 }
+
+void AbstractSimulationHandler::setPrefetching(const uint32_t numFrames,
+                                               const int32_t delta)
+{
+    _playbackDelta = delta;
+    if (!_frameLoader || numFrames == _prefetchFrames)
+        return;
+
+    _prefetchFrames = numFrames;
+    _prefetcher.reset();
+    if (numFrames > 0)
+        _prefetcher = std::make_unique<FramePrefetcher>(_frameLoader, _nbFrames,
+                                                        numFrames);
+}
+
+FramePrefetcher::Counters AbstractSimulationHandler::getPrefetchCounters() const
+{
+    return _prefetcher ? _prefetcher->getCounters()
+                       : FramePrefetcher::Counters();
+}
+
+FrameCache::Counters AbstractSimulationHandler::getFrameCacheCounters() const
+{
+    return _frameCache ? _frameCache->getCounters() : FrameCache::Counters();
+}
+
+bool AbstractSimulationHandler::_takePrefetchedFrame(const uint32_t frame)
+{
+    // e.g. going back to the current frame after a miss on the next one
+    if (frame == _currentFrame)
+        return true;
+
+    floats data;
+    if (!_prefetcher->take(frame, _playbackDelta, data))
+        return false;
+
+    // failed loads are reported by the prefetcher and retried on next request
+    if (data.empty() && _frameSize > 0)
+        return false;
+
+    _frameData = std::move(data);
+    _handedOverFrameData = nullptr;
+    _currentFrame = frame;
+    return true;
+}
+
+void AbstractSimulationHandler::_waitPrefetchedFrame(const uint32_t frame) const
+{
+    _prefetcher->wait(frame);
+}
+
+bool AbstractSimulationHandler::_handOverFrameData(const uint32_t frame,
+                                                  floats& buffer)
+{
+    const auto data = static_cast<const float*>(getFrameData(frame));
+    if (!data)
+        return false;
+
+    // e.g. the previous frame while loading, which was handed over already
+    if (data != _frameData.data() || _frameData.size() != _frameSize)
+    {
+        buffer.assign(data, data + _frameSize);
+        return true;
+    }
+
+    std::swap(_frameData, buffer);
+    _handedOverFrameData = &buffer;
+    return true;
+}
 }
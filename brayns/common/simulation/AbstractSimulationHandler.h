@@ -21,6 +21,9 @@
 #define ABSTRACTSIMULATIONHANDLER_H
 
 #include <brayns/api.h>
+#include <brayns/common/simulation/FrameCache.h>
+#include <brayns/common/simulation/FramePrefetcher.h>
+#include <brayns/common/simulation/FrameTransforms.h>
 #include <brayns/common/types.h>
 
 namespace brayns
@@ -35,8 +38,11 @@ public:
     /** @return a clone of the concrete simulation handler implementation. */
     virtual AbstractSimulationHandlerPtr clone() const = 0;
 
+    AbstractSimulationHandler() = default;
     virtual ~AbstractSimulationHandler();
 
+    /** Copies the simulation state, but not the frame read-ahead. */
+    AbstractSimulationHandler(const AbstractSimulationHandler& rhs);
     AbstractSimulationHandler& operator=(const AbstractSimulationHandler& rhs);
 
     BRAYNS_API virtual void bind(const MaterialPtr& /* material */){};
@@ -54,6 +60,24 @@ public:
         return _frameData.data();
     }
 
+    /**
+     * Get the values of the given frame like getFrameData() does, but into
+     * buffer, e.g. the back buffer of a double-buffered model. The default
+     * implementation copies them; handlers which load each frame into
+     * _frameData hand it over without copying, see _handOverFrameData().
+     * @return false if there is no data for the frame yet
+     */
+    virtual bool takeFrameData(uint32_t frame, floats& buffer);
+
+    /**
+     * Select the values of the given frame which are less than epsilon away
+     * from value, see selectFrameValues(). Waits for frames which are
+     * loaded asynchronously.
+     * @return false if the frame could not be loaded
+     */
+    bool selectValues(uint32_t frame, float value, float epsilon,
+                      uint8_ts& mask);
+
     /**
      * @brief getFrameSize return the size of the current simulation frame
      */
@@ -82,9 +106,58 @@ public:
     virtual bool isReady() const { return true; }
     /** Wait until current frame is ready */
     virtual void waitReady() const {}
+
+    /**
+     * Set the number of frames to read ahead in the playback direction given
+     * by delta, if supported by the implementation. 0 disables read-ahead.
+     */
+    void setPrefetching(uint32_t numFrames, int32_t delta);
+
+    /** @return the read-ahead counters, all 0 if read-ahead is not used. */
+    FramePrefetcher::Counters getPrefetchCounters() const;
+
+    /** @return the frame cache counters, all 0 if frames are not cached. */
+    FrameCache::Counters getFrameCacheCounters() const;
+
 protected:
     uint32_t _getBoundedFrame(const uint32_t frame) const;
 
+    /**
+     * Enable read-ahead support with the given function to load a frame on a
+     * background thread. The function must not capture this handler, as it
+     * may outlive its implementation during destruction.
+     */
+    void _setFrameLoader(FramePrefetcher::LoadFunction loader)
+    {
+        _frameLoader = std::move(loader);
+    }
+
+    /** @return true if frames are read ahead, see _takePrefetchedFrame(). */
+    bool _isPrefetching() const { return !!_prefetcher; }
+    /**
+     * Make the given frame the current one if it was read ahead already, and
+     * continue reading the following frames.
+     * @return true if the frame is the current one now or was already,
+     *         false if the frame is not loaded yet or failed to load
+     */
+    bool _takePrefetchedFrame(uint32_t frame);
+    /** Block until the given frame was read ahead. */
+    void _waitPrefetchedFrame(uint32_t frame) const;
+
+    /**
+     * takeFrameData() implementation which swaps _frameData with buffer if it
+     * has the values of the frame. buffer then has the values of the current
+     * frame until another one is loaded, see _getFrameData(), and its owner
+     * must not change it before taking another frame.
+     */
+    bool _handOverFrameData(uint32_t frame, floats& buffer);
+    /** @return the values of the current frame, see _handOverFrameData(). */
+    float* _getFrameData()
+    {
+        return _handedOverFrameData ? _handedOverFrameData->data()
+                                    : _frameData.data();
+    }
+
     uint32_t _currentFrame{std::numeric_limits<uint32_t>::max()};
     uint32_t _nbFrames{0};
     uint64_t _frameSize{0};
@@ -92,6 +165,17 @@ protected:
     std::string _unit;
 
     floats _frameData;
+    /** Where the current frame went, reset when _frameData has new values */
+    floats* _handedOverFrameData{nullptr};
+
+    /** Optional local cache of loaded frames, shared with clones */
+    std::shared_ptr<FrameCache> _frameCache;
+
+private:
+    FramePrefetcher::LoadFunction _frameLoader;
+    uint32_t _prefetchFrames{0};
+    int32_t _playbackDelta{1};
+    std::unique_ptr<FramePrefetcher> _prefetcher;
 };
 }
 #endif // ABSTRACTSIMULATIONHANDLER_H
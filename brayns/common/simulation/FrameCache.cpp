@@ -0,0 +1,127 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "FrameCache.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace brayns
+{
+FrameCache::FrameCache(const std::string& directory, const uint64_t frameSize,
+                       const uint32_t nbFrames, const uint64_t budget)
+    : _frameSize(frameSize)
+{
+    const uint64_t frameBytes = frameSize * sizeof(float);
+    if (frameBytes == 0)
+        throw std::runtime_error("Cannot cache empty simulation frames");
+
+    _capacity = std::min(uint64_t(nbFrames), budget / frameBytes);
+    if (_capacity == 0)
+        throw std::runtime_error(
+            "Frame cache budget is smaller than one simulation frame");
+    _mappedSize = _capacity * frameBytes;
+
+    std::string path = directory + "/brayns_frames_XXXXXX";
+    const int fd = mkstemp(&path[0]);
+    if (fd == -1)
+        throw std::runtime_error("Could not create frame cache in " +
+                                 directory);
+
+    // the file is gone once unmapped, also if the process dies
+    unlink(path.c_str());
+
+    if (ftruncate(fd, _mappedSize) != 0)
+    {
+        close(fd);
+        throw std::runtime_error("Could not allocate frame cache in " +
+                                 directory);
+    }
+
+    auto data =
+        mmap(nullptr, _mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        throw std::runtime_error("Could not map frame cache in " + directory);
+    _data = static_cast<float*>(data);
+}
+
+FrameCache::~FrameCache()
+{
+    munmap(_data, _mappedSize);
+}
+
+bool FrameCache::read(const uint32_t frame, floats& data)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto i = _entries.find(frame);
+    if (i == _entries.end())
+    {
+        ++_counters.misses;
+        return false;
+    }
+
+    ++_counters.hits;
+    _lru.splice(_lru.begin(), _lru, i->second.lru);
+
+    const auto src = _slotData(i->second.slot);
+    data.assign(src, src + _frameSize);
+    return true;
+}
+
+void FrameCache::write(const uint32_t frame, const floats& data)
+{
+    if (data.size() != _frameSize)
+        return;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_entries.count(frame))
+        return;
+
+    size_t slot;
+    if (_usedSlots < _capacity)
+        slot = _usedSlots++;
+    else
+    {
+        const auto evicted = _lru.back();
+        _lru.pop_back();
+        slot = _entries[evicted].slot;
+        _entries.erase(evicted);
+        ++_counters.evictions;
+    }
+
+    memcpy(_slotData(slot), data.data(), _frameSize * sizeof(float));
+    _lru.push_front(frame);
+    _entries[frame] = {slot, _lru.begin()};
+}
+
+FrameCache::Counters FrameCache::getCounters() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _counters;
+}
+
+float* FrameCache::_slotData(const size_t slot) const
+{
+    return _data + slot * _frameSize;
+}
+}
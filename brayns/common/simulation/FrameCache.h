@@ -0,0 +1,91 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/common/types.h>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace brayns
+{
+/**
+ * A local cache of simulation frames in a memory-mapped file, so frames which
+ * were loaded once do not need to be read from the (potentially remote)
+ * report again. Each frame is stored contiguously in the order of the frame
+ * data; the least recently used frames are evicted if the disk budget is
+ * exceeded. The cache file is removed when the cache is destroyed.
+ */
+class FrameCache
+{
+public:
+    struct Counters
+    {
+        /** Reads of frames which were in the cache */
+        size_t hits{0};
+        /** Reads of frames which were not in the cache */
+        size_t misses{0};
+        /** Frames which were evicted to store another one */
+        size_t evictions{0};
+    };
+
+    /**
+     * @param directory the directory to create the cache file in
+     * @param frameSize the number of values per frame
+     * @param nbFrames the number of frames of the simulation
+     * @param budget the maximum size of the cache file in bytes
+     * @throw std::runtime_error if the cache file could not be created
+     */
+    FrameCache(const std::string& directory, uint64_t frameSize,
+               uint32_t nbFrames, uint64_t budget);
+    ~FrameCache();
+
+    /** @return true and the data of the frame if it is in the cache. */
+    bool read(uint32_t frame, floats& data);
+
+    /** Store the data of the frame, evicting the least recently used one. */
+    void write(uint32_t frame, const floats& data);
+
+    /** @return the number of frames which fit in the cache. */
+    size_t getCapacity() const { return _capacity; }
+
+    Counters getCounters() const;
+
+private:
+    float* _slotData(size_t slot) const;
+
+    const uint64_t _frameSize;
+    size_t _capacity{0};
+    size_t _mappedSize{0};
+    float* _data{nullptr};
+
+    struct Entry
+    {
+        size_t slot;
+        std::list<uint32_t>::iterator lru;
+    };
+    std::unordered_map<uint32_t, Entry> _entries;
+    std::list<uint32_t> _lru; // most recently used first
+    size_t _usedSlots{0};
+    Counters _counters;
+    mutable std::mutex _mutex;
+};
+}
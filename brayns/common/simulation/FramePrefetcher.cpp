@@ -0,0 +1,191 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "FramePrefetcher.h"
+
+#include <brayns/common/log.h>
+
+#include <algorithm>
+
+namespace brayns
+{
+FramePrefetcher::FramePrefetcher(LoadFunction load, const uint32_t nbFrames,
+                                 const uint32_t capacity)
+    : _load(std::move(load))
+    , _nbFrames(std::max(nbFrames, 1u))
+    , _slots(std::max(capacity, 1u))
+    , _thread([this] { _run(); })
+{
+}
+
+FramePrefetcher::~FramePrefetcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+}
+
+bool FramePrefetcher::take(const uint32_t frame, const int32_t delta,
+                           floats& data)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    auto slot = _findSlot(frame);
+    const bool loaded = slot && slot->state == State::loaded;
+    if (loaded)
+    {
+        data = std::move(slot->data);
+        slot->data = floats();
+        slot->state = State::empty;
+        if (frame != _lastMissed)
+            ++_counters.hits;
+        _lastMissed = std::numeric_limits<uint32_t>::max();
+
+        // keep the following frames, the taken one is not needed anymore
+        _setWanted(int64_t(frame) + delta, delta, _slots.size());
+    }
+    else
+    {
+        if (frame != _lastMissed)
+            ++_counters.misses;
+        else
+            ++_counters.stalls;
+        _lastMissed = frame;
+
+        _setWanted(frame, delta, _slots.size());
+    }
+
+    lock.unlock();
+    _condition.notify_all();
+    return loaded;
+}
+
+void FramePrefetcher::wait(const uint32_t frame) const
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [&] {
+        const auto slot = _findSlot(frame);
+        return _stop || !_isWanted(frame) ||
+               (slot && slot->state == State::loaded);
+    });
+}
+
+FramePrefetcher::Counters FramePrefetcher::getCounters() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _counters;
+}
+
+void FramePrefetcher::_run()
+{
+    for (;;)
+    {
+        uint32_t frame = 0;
+        size_t index = 0;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock,
+                            [&] { return _stop || _nextLoad(frame, index); });
+            if (_stop)
+                return;
+            _slots[index].frame = frame;
+            _slots[index].state = State::loading;
+            _slots[index].data = floats();
+        }
+
+        floats data;
+        try
+        {
+            data = _load(frame);
+        }
+        catch (const std::exception& e)
+        {
+            BRAYNS_ERROR << "Error loading simulation frame " << frame << ": "
+                         << e.what() << std::endl;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _slots[index].data = std::move(data);
+            _slots[index].state = State::loaded;
+        }
+        _condition.notify_all();
+    }
+}
+
+void FramePrefetcher::_setWanted(const int64_t first, const int32_t delta,
+                                 const uint32_t count)
+{
+    _wanted.clear();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        const int64_t frame =
+            (first + int64_t(i) * delta) % int64_t(_nbFrames);
+        const auto wrapped = uint32_t(frame < 0 ? frame + _nbFrames : frame);
+        if (_isWanted(wrapped))
+            break;
+        _wanted.push_back(wrapped);
+    }
+}
+
+bool FramePrefetcher::_isWanted(const uint32_t frame) const
+{
+    return std::find(_wanted.begin(), _wanted.end(), frame) != _wanted.end();
+}
+
+FramePrefetcher::Slot* FramePrefetcher::_findSlot(const uint32_t frame)
+{
+    for (auto& slot : _slots)
+        if (slot.state != State::empty && slot.frame == frame)
+            return &slot;
+    return nullptr;
+}
+
+const FramePrefetcher::Slot* FramePrefetcher::_findSlot(
+    const uint32_t frame) const
+{
+    return const_cast<FramePrefetcher*>(this)->_findSlot(frame);
+}
+
+bool FramePrefetcher::_nextLoad(uint32_t& frame, size_t& index) const
+{
+    // the first wanted frame which is neither loaded nor loading
+    auto i = std::find_if(_wanted.begin(), _wanted.end(),
+                          [&](const uint32_t f) { return !_findSlot(f); });
+    if (i == _wanted.end())
+        return false;
+
+    // an empty slot or one with a frame which is not wanted anymore
+    for (size_t j = 0; j < _slots.size(); ++j)
+    {
+        const auto& slot = _slots[j];
+        if (slot.state == State::empty ||
+            (slot.state == State::loaded && !_isWanted(slot.frame)))
+        {
+            frame = *i;
+            index = j;
+            return true;
+        }
+    }
+    return false;
+}
+}
@@ -0,0 +1,111 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/common/types.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace brayns
+{
+/**
+ * Reads simulation frames ahead of the playback on a background thread into a
+ * ring buffer of a fixed number of frames. The frames to read are the
+ * requested frame and the following ones in playback direction, wrapping
+ * around at the end of the simulation like the animation does.
+ */
+class FramePrefetcher
+{
+public:
+    /** Loads the data of the given frame, called from the I/O thread. */
+    using LoadFunction = std::function<floats(uint32_t frame)>;
+
+    struct Counters
+    {
+        /** Requested frames which were read ahead already */
+        size_t hits{0};
+        /** Requested frames which were not read ahead */
+        size_t misses{0};
+        /** Requests which could not be served as the frame was not loaded */
+        size_t stalls{0};
+    };
+
+    /**
+     * @param load the function to load a frame
+     * @param nbFrames the number of frames of the simulation
+     * @param capacity the number of frames to keep in the ring buffer
+     */
+    FramePrefetcher(LoadFunction load, uint32_t nbFrames, uint32_t capacity);
+    ~FramePrefetcher();
+
+    /**
+     * Move the data of the given frame out of the ring buffer and schedule
+     * reading the following frames in playback direction. If the frame is not
+     * loaded yet, it is scheduled first.
+     *
+     * @param frame the requested frame
+     * @param delta the playback delta to select the following frames
+     * @param data receives the frame data if loaded
+     * @return true if the frame was loaded
+     */
+    bool take(uint32_t frame, int32_t delta, floats& data);
+
+    /** Block until the given frame is loaded, after it was requested. */
+    void wait(uint32_t frame) const;
+
+    Counters getCounters() const;
+
+private:
+    enum class State
+    {
+        empty,
+        loading,
+        loaded
+    };
+
+    struct Slot
+    {
+        uint32_t frame{0};
+        State state{State::empty};
+        floats data;
+    };
+
+    void _run();
+    void _setWanted(int64_t first, int32_t delta, uint32_t count);
+    bool _isWanted(uint32_t frame) const;
+    Slot* _findSlot(uint32_t frame);
+    const Slot* _findSlot(uint32_t frame) const;
+    bool _nextLoad(uint32_t& frame, size_t& slot) const;
+
+    const LoadFunction _load;
+    const uint32_t _nbFrames;
+    std::vector<Slot> _slots;
+    std::vector<uint32_t> _wanted;
+    uint32_t _lastMissed{std::numeric_limits<uint32_t>::max()};
+    Counters _counters;
+    bool _stop{false};
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _condition;
+    std::thread _thread;
+};
+}
@@ -0,0 +1,55 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "FrameTransforms.h"
+
+#include <cmath>
+
+namespace
+{
+// below this, the thread startup costs more than the transform
+const int64_t MIN_PARALLEL_SIZE = 1 << 16;
+}
+
+namespace brayns
+{
+void decayFrameValues(float* values, const uint64_t size, const float from,
+                      const float to, const float speed)
+{
+    const int64_t n = size;
+#pragma omp parallel for simd if (n >= MIN_PARALLEL_SIZE)
+    for (int64_t i = 0; i < n; ++i)
+    {
+        // NaN from an infinite time without decay selects 'to'
+        const float decayed = from - values[i] * speed;
+        values[i] = decayed > to ? decayed : to;
+    }
+}
+
+void selectFrameValues(const float* values, const uint64_t size,
+                       const float value, const float epsilon, uint8_ts& mask)
+{
+    mask.resize(size);
+    uint8_t* out = mask.data();
+    const int64_t n = size;
+#pragma omp parallel for simd if (n >= MIN_PARALLEL_SIZE)
+    for (int64_t i = 0; i < n; ++i)
+        out[i] = std::abs(values[i] - value) < epsilon;
+}
+}
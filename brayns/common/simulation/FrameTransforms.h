@@ -0,0 +1,47 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/common/types.h>
+
+namespace brayns
+{
+/**
+ * Element-wise transforms of simulation frames, e.g. as returned by
+ * AbstractSimulationHandler::getFrameData(). They are vectorized and run
+ * multithreaded for large frames.
+ */
+
+/**
+ * Decay values linearly from 'from' to 'to'. values[i] holds the time elapsed
+ * since the decay started, in units of 'speed', and receives
+ * max(to, from - values[i] * speed). An infinite time gives 'to', also with a
+ * speed of 0.
+ */
+void decayFrameValues(float* values, uint64_t size, float from, float to,
+                      float speed);
+
+/**
+ * Set mask[i] to 1 if values[i] is less than epsilon away from value, 0
+ * otherwise. The mask is resized to the number of values.
+ */
+void selectFrameValues(const float* values, uint64_t size, float value,
+                       float epsilon, uint8_ts& mask);
+}
@@ -178,6 +178,7 @@ enum class FrameBufferFormat
     bgra_i8,
     rgb_i8,
     rgb_f32,
+    rgba_f32,
     none
 };
 
@@ -0,0 +1,81 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/common/types.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace brayns
+{
+/**
+ * Sequential reader of scalars and typed arrays from a binary blob, e.g. the
+ * attachment of a binary notification. Values are expected in the native
+ * (little-endian) byte order and tightly packed.
+ */
+class BinaryReader
+{
+public:
+    explicit BinaryReader(const uint8_ts& data)
+        : _data(data)
+    {
+    }
+
+    template <typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "BinaryReader can only read trivially copyable types");
+        T value;
+        _copy(&value, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    std::vector<T> readArray(const size_t count)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "BinaryReader can only read trivially copyable types");
+        if (count > remaining() / sizeof(T))
+            throw std::runtime_error("Binary data too small for array");
+        std::vector<T> values(count);
+        _copy(values.data(), count * sizeof(T));
+        return values;
+    }
+
+    size_t remaining() const { return _data.size() - _offset; }
+    bool atEnd() const { return _offset == _data.size(); }
+
+private:
+    void _copy(void* dst, const size_t size)
+    {
+        if (size > remaining())
+            throw std::runtime_error("Binary data too small");
+        if (size > 0)
+            memcpy(dst, _data.data() + _offset, size);
+        _offset += size;
+    }
+
+    const uint8_ts& _data;
+    size_t _offset{0};
+};
+} // namespace brayns
@@ -0,0 +1,148 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+// Low-discrepancy sampling for progressive rendering: a Sobol (0,2)-sequence
+// with hash based Owen scrambling and shuffling, see "Practical Hash-based
+// Owen Scrambling", Burley, JCGT 2020. Successive accumulation frames of a
+// pixel get successive, well stratified points of the sequence, while the
+// scrambling decorrelates pixels and sampling dimensions.
+//
+// Shared by the ISPC renderers and the C++ code, see
+// engines/ospray/ispc/render/utils/LowDiscrepancy.ih.
+
+#if __cplusplus
+namespace brayns
+{
+#endif
+
+inline unsigned int reverseBits(unsigned int x)
+{
+    x = (x << 16) | (x >> 16);
+    x = ((x & 0x00ff00ff) << 8) | ((x & 0xff00ff00) >> 8);
+    x = ((x & 0x0f0f0f0f) << 4) | ((x & 0xf0f0f0f0) >> 4);
+    x = ((x & 0x33333333) << 2) | ((x & 0xcccccccc) >> 2);
+    x = ((x & 0x55555555) << 1) | ((x & 0xaaaaaaaa) >> 1);
+    return x;
+}
+
+inline unsigned int hashValue(unsigned int x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352d;
+    x ^= x >> 15;
+    x *= 0x846ca68b;
+    x ^= x >> 16;
+    return x;
+}
+
+inline unsigned int hashCombine(const unsigned int seed, const unsigned int v)
+{
+    return seed ^ (v + (seed << 6) + (seed >> 2));
+}
+
+inline unsigned int laineKarrasPermutation(unsigned int x,
+                                           const unsigned int seed)
+{
+    x += seed;
+    x ^= x * 0x6c50b47c;
+    x ^= x * 0xb82f1e52;
+    x ^= x * 0xc7afe638;
+    x ^= x * 0x8d22f6e6;
+    return x;
+}
+
+inline unsigned int nestedUniformScramble(unsigned int x,
+                                          const unsigned int seed)
+{
+    x = reverseBits(x);
+    x = laineKarrasPermutation(x, seed);
+    return reverseBits(x);
+}
+
+// Second Sobol dimension, the first one is the bit reversed index
+inline unsigned int sobol1(unsigned int index)
+{
+    unsigned int result = 0;
+    unsigned int v = 0x80000000;
+    while (index != 0)
+    {
+        if ((index & 1) != 0)
+            result ^= v;
+        index >>= 1;
+        v ^= v >> 1;
+    }
+    return result;
+}
+
+inline float toUnitFloat(const unsigned int x)
+{
+    // largest float below 1
+    const float value = (float)x * 2.3283064365386963e-10f;
+    return value < 0.99999994f ? value : 0.99999994f;
+}
+
+/**
+    Computes the point 'index' of a shuffled and scrambled 2D Sobol sequence.
+    @param index Index of the point in the sequence
+    @param seed Seed of the scrambling, different seeds give uncorrelated
+   sequences
+    @param x First coordinate of the point, in [0, 1)
+    @param y Second coordinate of the point, in [0, 1)
+*/
+inline void getSobolSample(const unsigned int index, const unsigned int seed,
+                           float& x, float& y)
+{
+    const unsigned int shuffled = nestedUniformScramble(index, seed);
+    const unsigned int scrambleSeed = hashValue(seed);
+    x = toUnitFloat(nestedUniformScramble(reverseBits(shuffled),
+                                          hashCombine(scrambleSeed, 0)));
+    y = toUnitFloat(
+        nestedUniformScramble(sobol1(shuffled), hashCombine(scrambleSeed, 1)));
+}
+
+/**
+    @return The seed of the sequence of a pixel for the given dimension
+*/
+inline unsigned int getPixelSeed(const unsigned int x, const unsigned int y,
+                                 const unsigned int dimension)
+{
+    return hashValue(hashCombine(hashCombine(hashValue(x), y), dimension));
+}
+
+/**
+    Returns the sampling dimension of an effect. Each effect of a renderer, and
+   each of its samples within a frame, must use its own dimension, otherwise
+   they get the same points and are correlated.
+    @param effect Identifies the sampled effect within the renderer
+    @param iteration Sample of the effect within the frame
+    @param seed Seed of the renderer
+    @return A dimension for getLowDiscrepancySample()
+*/
+inline unsigned int getSamplingDimension(const unsigned int effect,
+                                         const unsigned int iteration,
+                                         const unsigned int seed)
+{
+    return hashCombine(hashCombine(hashValue(effect), iteration), seed);
+}
+
+#if __cplusplus
+} // brayns
+#endif
@@ -0,0 +1,140 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "MacroCells.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+uint32_t _numCells(const uint32_t dimension)
+{
+    // cells span the voxel coordinates [0, dimension - 1]
+    return std::max(1u, (dimension + brayns::MACRO_CELL_SIZE - 2) /
+                            brayns::MACRO_CELL_SIZE);
+}
+
+template <typename T>
+void _updateRanges(const T* voxels, const brayns::Vector3ui& position,
+                   const brayns::Vector3ui& size,
+                   const brayns::Vector3ui& volumeDimensions,
+                   brayns::Vector2fs& ranges)
+{
+    const auto S = brayns::MACRO_CELL_SIZE;
+    const auto cells = brayns::getMacroCellDimensions(volumeDimensions);
+    const auto end = position + size;
+
+    // a voxel on a cell border belongs to both adjacent cells
+    const auto firstCell =
+        (glm::max(position, brayns::Vector3ui(1)) - 1u) / S;
+    const brayns::Vector3ui lastCell(std::min((end.x - 1) / S, cells.x - 1),
+                                     std::min((end.y - 1) / S, cells.y - 1),
+                                     std::min((end.z - 1) / S, cells.z - 1));
+    const auto numCells = lastCell - firstCell + brayns::Vector3ui(1);
+    const int64_t n = int64_t(numCells.x) * numCells.y * numCells.z;
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < n; ++i)
+    {
+        const auto cell =
+            firstCell + brayns::Vector3ui(i % numCells.x,
+                                          (i / numCells.x) % numCells.y,
+                                          i / numCells.x / numCells.y);
+        const auto lo = glm::max(cell * S, position);
+        const auto hi = glm::min(cell * S + S + 1u, end);
+
+        auto& range = ranges[(size_t(cell.z) * cells.y + cell.y) * cells.x +
+                             cell.x];
+        for (uint32_t z = lo.z; z < hi.z; ++z)
+            for (uint32_t y = lo.y; y < hi.y; ++y)
+            {
+                const T* row =
+                    voxels +
+                    (size_t(z - position.z) * size.y + (y - position.y)) *
+                        size.x;
+                for (uint32_t x = lo.x; x < hi.x; ++x)
+                {
+                    const float value = row[x - position.x];
+                    range.x = std::min(range.x, value);
+                    range.y = std::max(range.y, value);
+                }
+            }
+    }
+}
+} // namespace
+
+namespace brayns
+{
+Vector3ui getMacroCellDimensions(const Vector3ui& volumeDimensions)
+{
+    return {_numCells(volumeDimensions.x), _numCells(volumeDimensions.y),
+            _numCells(volumeDimensions.z)};
+}
+
+Vector2f getEmptyMacroCellRange()
+{
+    return {std::numeric_limits<float>::max(),
+            std::numeric_limits<float>::lowest()};
+}
+
+void updateMacroCellRanges(const void* voxels, const DataType type,
+                           const Vector3ui& position, const Vector3ui& size,
+                           const Vector3ui& volumeDimensions, Vector2fs& ranges)
+{
+    if (glm::compMul(size) == 0)
+        return;
+
+    switch (type)
+    {
+    case DataType::FLOAT:
+        _updateRanges(static_cast<const float*>(voxels), position, size,
+                      volumeDimensions, ranges);
+        break;
+    case DataType::DOUBLE:
+        _updateRanges(static_cast<const double*>(voxels), position, size,
+                      volumeDimensions, ranges);
+        break;
+    case DataType::UINT8:
+        _updateRanges(static_cast<const uint8_t*>(voxels), position, size,
+                      volumeDimensions, ranges);
+        break;
+    case DataType::UINT16:
+        _updateRanges(static_cast<const uint16_t*>(voxels), position, size,
+                      volumeDimensions, ranges);
+        break;
+    case DataType::UINT32:
+        _updateRanges(static_cast<const uint32_t*>(voxels), position, size,
+                      volumeDimensions, ranges);
+        break;
+    case DataType::INT8:
+        _updateRanges(static_cast<const int8_t*>(voxels), position, size,
+                      volumeDimensions, ranges);
+        break;
+    case DataType::INT16:
+        _updateRanges(static_cast<const int16_t*>(voxels), position, size,
+                      volumeDimensions, ranges);
+        break;
+    case DataType::INT32:
+        _updateRanges(static_cast<const int32_t*>(voxels), position, size,
+                      volumeDimensions, ranges);
+        break;
+    }
+}
+}
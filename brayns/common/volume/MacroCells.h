@@ -0,0 +1,60 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/common/types.h>
+
+namespace brayns
+{
+/**
+ * A coarse grid over the voxels of a volume, storing the range of voxel values
+ * per macro cell. Renderers use it to skip cells in which the transfer function
+ * is transparent for all values.
+ *
+ * Macro cell (i, j, k) covers the voxel coordinates [i, i + 1] *
+ * MACRO_CELL_SIZE on x (same for y and z), so its range includes the voxels of
+ * the next cell that are read by trilinear interpolation inside the cell.
+ */
+
+/** Number of voxels along each edge of a macro cell. */
+const uint32_t MACRO_CELL_SIZE = 16;
+
+/** @return the number of macro cells along each axis of a volume. */
+Vector3ui getMacroCellDimensions(const Vector3ui& volumeDimensions);
+
+/**
+ * @return the range of a macro cell that contains no voxels yet. Its minimum is
+ * larger than its maximum, renderers must not skip such a cell.
+ */
+Vector2f getEmptyMacroCellRange();
+
+/**
+ * Extend the ranges of all macro cells overlapping the given brick of voxels.
+ *
+ * @param voxels brick data of the given type, x varying fastest
+ * @param position position of the brick in the volume, in voxels
+ * @param size size of the brick, in voxels
+ * @param ranges one range per macro cell, x varying fastest
+ */
+void updateMacroCellRanges(const void* voxels, DataType type,
+                           const Vector3ui& position, const Vector3ui& size,
+                           const Vector3ui& volumeDimensions,
+                           Vector2fs& ranges);
+}
@@ -116,6 +116,20 @@ public:
     }
     /** @internal @return the current rendererd frame buffer. */
     const std::string& getBufferTarget() const { return _bufferTarget; }
+
+    /**
+     * @internal Sets the region of the image to render in normalized screen
+     * coordinates with the origin at the bottom left, e.g. for tiled rendering.
+     */
+    void setImageRegion(const Vector2f& start, const Vector2f& end)
+    {
+        _updateValue(_imageStart, start, false);
+        _updateValue(_imageEnd, end, false);
+    }
+    /** @internal @return the start of the rendered image region. */
+    const Vector2f& getImageStart() const { return _imageStart; }
+    /** @internal @return the end of the rendered image region. */
+    const Vector2f& getImageEnd() const { return _imageEnd; }
 private:
     Vector3d _target;
     Vector3d _position;
@@ -126,6 +140,8 @@ private:
     Quaterniond _initialOrientation;
 
     std::string _bufferTarget;
+    Vector2f _imageStart{0.f, 0.f};
+    Vector2f _imageEnd{1.f, 1.f};
 
     SERIALIZATION_FRIEND(Camera)
 };
@@ -81,7 +81,8 @@ bool Engine::continueRendering() const
     return _parametersManager.getAnimationParameters().isPlaying() ||
            (frameBuffer->getAccumulation() &&
             (frameBuffer->numAccumFrames() <
-             _parametersManager.getRenderingParameters().getMaxAccumFrames()));
+             _parametersManager.getRenderingParameters().getMaxAccumFrames()) &&
+            !_renderer->hasConverged(*frameBuffer));
 }
 
 void Engine::addFrameBuffer(FrameBufferPtr frameBuffer)
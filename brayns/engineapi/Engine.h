@@ -109,8 +109,9 @@ public:
     Statistics& getStatistics() { return _statistics; }
     /**
      * @return true if render() calls shall be continued, based on current
-     *         accumulation settings.
+     *         accumulation settings and the variance of the last frame.
      * @sa RenderingParameters::setMaxAccumFrames
+     * @sa RenderingParameters::setVarianceThreshold
      */
     bool continueRendering() const;
 
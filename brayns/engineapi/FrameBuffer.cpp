@@ -20,6 +20,8 @@
 
 #include "FrameBuffer.h"
 
+#include <cstring>
+
 namespace brayns
 {
 FrameBuffer::FrameBuffer(const std::string& name, const Vector2ui& frameSize,
@@ -40,6 +42,8 @@ size_t FrameBuffer::getColorDepth() const
         return 4;
     case FrameBufferFormat::rgb_i8:
         return 3;
+    case FrameBufferFormat::rgba_f32:
+        return 4 * sizeof(float);
     default:
         return 0;
     }
@@ -52,6 +56,20 @@ freeimage::ImagePtr FrameBuffer::getImage()
     const auto colorBuffer = getColorBuffer();
     const auto& size = getSize();
 
+    if (_frameBufferFormat == FrameBufferFormat::rgba_f32)
+    {
+        // floating point images are always stored in RGBA order and bottom-up
+        // like the frame buffer
+        freeimage::ImagePtr image(
+            FreeImage_AllocateT(FIT_RGBAF, size.x, size.y));
+        const size_t rowSize = size.x * getColorDepth();
+        for (uint32_t y = 0; y < size.y; ++y)
+            memcpy(FreeImage_GetScanLine(image.get(), y),
+                   colorBuffer + y * rowSize, rowSize);
+        unmap();
+        return image;
+    }
+
     freeimage::ImagePtr image(
         FreeImage_ConvertFromRawBits(const_cast<uint8_t*>(colorBuffer), size.x,
                                      size.y, getColorDepth() * size.x,
@@ -68,4 +86,27 @@ freeimage::ImagePtr FrameBuffer::getImage()
     return nullptr;
 #endif
 }
+
+freeimage::ImagePtr FrameBuffer::getDepthImage()
+{
+#ifdef BRAYNS_USE_FREEIMAGE
+    map();
+    const auto depthBuffer = getDepthBuffer();
+    const auto& size = getSize();
+
+    freeimage::ImagePtr image;
+    if (depthBuffer)
+    {
+        image.reset(FreeImage_AllocateT(FIT_FLOAT, size.x, size.y));
+        for (uint32_t y = 0; y < size.y; ++y)
+            memcpy(FreeImage_GetScanLine(image.get(), y),
+                   depthBuffer + size_t(y) * size.x, size.x * sizeof(float));
+    }
+
+    unmap();
+    return image;
+#else
+    return nullptr;
+#endif
+}
 }
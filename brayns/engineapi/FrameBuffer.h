@@ -78,7 +78,10 @@ public:
     const std::string& getName() const { return _name; }
     void incrementAccumFrames() { ++_accumFrames; }
     size_t numAccumFrames() const { return _accumFrames; }
+    /** @return the color buffer as an image, floating point for rgba_f32. */
     freeimage::ImagePtr getImage();
+    /** @return the depth buffer as a floating point image, or nullptr. */
+    freeimage::ImagePtr getDepthImage();
 
 protected:
     const std::string _name;
@@ -304,6 +304,20 @@ bool Model::isDirty() const
     return _areGeometriesDirty() || _instancesDirty;
 }
 
+bool Model::hasPendingChanges() const
+{
+    if (isDirty() || _volumesDirty || _transferFunction.isModified())
+        return true;
+    for (const auto& material : _materials)
+        if (material.second->isModified())
+            return true;
+    for (const auto& volume : _geometries->_volumes)
+        if (volume->isModified())
+            return true;
+    return _simulationHandler && _simulationHandler->getCurrentFrame() !=
+                                     _animationParameters.getFrame();
+}
+
 void Model::setMaterialsColorMap(const MaterialsColorMap colorMap)
 {
     size_t index = 0;
@@ -670,14 +684,26 @@ bool Model::commitSimulationData()
         _isReadyCallbackSet = true;
     }
 
+    _simulationHandler->setPrefetching(_animationParameters.getPrefetchFrames(),
+                                       _animationParameters.getDelta());
+
     const auto animationFrame = _animationParameters.getFrame();
 
     if (_simulationHandler->getCurrentFrame() == animationFrame)
     {
+        // still committed, but the handler may wait for another frame after
+        // a miss on it
+        if (!_simulationHandler->isReady())
+            _simulationHandler->getFrameData(animationFrame);
         return false;
     }
 
-    auto frameData = _simulationHandler->getFrameData(animationFrame);
+    return _commitSimulationFrameImpl(animationFrame);
+}
+
+bool Model::_commitSimulationFrameImpl(const uint32_t frame)
+{
+    auto frameData = _simulationHandler->getFrameData(frame);
 
     if (!frameData)
         return false;
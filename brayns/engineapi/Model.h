@@ -272,6 +272,13 @@ public:
     /** @return true if the geometry Model is dirty, false otherwise */
     BRAYNS_API bool isDirty() const;
 
+    /**
+     * @return true if the next commit changes any engine object of the Model,
+     *         i.e. its geometry, materials, volumes, transfer function or
+     *         simulation data, false otherwise
+     */
+    bool hasPendingChanges() const;
+
     /**
         Returns the bounds for the Model
     */
@@ -496,6 +503,12 @@ protected:
     virtual void _commitTransferFunctionImpl(const Vector3fs& colors,
                                              const floats& opacities,
                                              const Vector2d valueRange) = 0;
+    /**
+     * Commit the values of the given simulation frame. The default passes the
+     * data of the handler's getFrameData() to _commitSimulationDataImpl().
+     * @return false if the handler has no data for the frame yet
+     */
+    virtual bool _commitSimulationFrameImpl(uint32_t frame);
     virtual void _commitSimulationDataImpl(const float* frameData,
                                            const size_t frameSize) = 0;
 
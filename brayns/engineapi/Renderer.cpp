@@ -20,6 +20,7 @@
 
 #include <brayns/common/types.h>
 
+#include "FrameBuffer.h"
 #include "Renderer.h"
 
 namespace brayns
@@ -30,4 +31,12 @@ Renderer::Renderer(const AnimationParameters& animationParameters,
     , _renderingParameters(renderingParameters)
 {
 }
+
+bool Renderer::hasConverged(const FrameBuffer& frameBuffer) const
+{
+    // the variance is only meaningful once two frames are accumulated
+    const auto threshold = _renderingParameters.getVarianceThreshold();
+    return threshold > 0. && frameBuffer.getAccumulation() &&
+           frameBuffer.numAccumFrames() > 1 && getVariance() <= threshold;
+}
 }
@@ -42,6 +42,12 @@ public:
 
     /** @return the variance from the previous render(). */
     virtual float getVariance() const { return 0.f; }
+    /**
+     * @return true if the variance from the previous render() into the given
+     *         frame buffer is below the variance threshold of the rendering
+     *         parameters, i.e. further accumulation is not needed.
+     */
+    BRAYNS_API bool hasConverged(const FrameBuffer& frameBuffer) const;
     virtual void commit() = 0;
     virtual void setCamera(CameraPtr camera) = 0;
     virtual PickResult pick(const Vector2f& /*pickPos*/)
@@ -32,6 +32,7 @@
 #include <brayns/common/utils/filesystem.h>
 
 #include <fstream>
+#include <mutex>
 
 namespace
 {
@@ -65,6 +66,16 @@ std::shared_ptr<T> _remove(std::vector<std::shared_ptr<T>>& list,
 
 namespace brayns
 {
+struct Scene::ModelSharing
+{
+    // held exclusively while the owner gives the sharing scenes a copy
+    std::shared_timed_mutex renderMutex;
+    std::mutex scenesMutex;
+    std::vector<Scene*> scenes;
+    // incremented each time the owner stops sharing its models
+    size_t generation{0};
+};
+
 Scene::Scene(AnimationParameters& animationParameters,
              GeometryParameters& geometryParameters,
              VolumeParameters& volumeParameters)
@@ -74,6 +85,11 @@ Scene::Scene(AnimationParameters& animationParameters,
 {
 }
 
+Scene::~Scene()
+{
+    _releaseSharedModels();
+}
+
 void Scene::copyFrom(const Scene& rhs)
 {
     if (this == &rhs)
@@ -99,6 +115,107 @@ void Scene::copyFrom(const Scene& rhs)
     markModified();
 }
 
+void Scene::shareModelsFrom(Scene& rhs)
+{
+    if (this == &rhs)
+        return;
+
+    if (!supportsModelSharing() || rhs._sharedModels ||
+        rhs._hasPendingModelChanges())
+    {
+        copyFrom(rhs);
+        return;
+    }
+
+    {
+        std::unique_lock<std::shared_timed_mutex> lock(_modelMutex);
+        std::shared_lock<std::shared_timed_mutex> rhsLock(rhs._modelMutex);
+        _modelDescriptors = rhs._modelDescriptors;
+    }
+    _computeBounds();
+
+    *_backgroundMaterial = *rhs._backgroundMaterial;
+    _backgroundMaterial->markModified();
+
+    _lightManager = rhs._lightManager;
+    _clipPlanes = rhs._clipPlanes;
+
+    if (!rhs._modelSharing)
+        rhs._modelSharing = std::make_shared<ModelSharing>();
+    _sharedModels = rhs._modelSharing;
+    {
+        std::lock_guard<std::mutex> lock(_sharedModels->scenesMutex);
+        _sharedGeneration = _sharedModels->generation;
+        _sharedModels->scenes.push_back(this);
+    }
+
+    _commitSharedModels();
+
+    markModified();
+}
+
+std::shared_lock<std::shared_timed_mutex> Scene::acquireRenderAccess() const
+{
+    if (!_sharedModels)
+        return {};
+    return std::shared_lock<std::shared_timed_mutex>(
+        _sharedModels->renderMutex);
+}
+
+bool Scene::sharesModels() const
+{
+    return _sharedModels && _sharedModels->generation == _sharedGeneration;
+}
+
+void Scene::stopSharingModels()
+{
+    if (!_modelSharing)
+        return;
+
+    std::lock_guard<std::mutex> lock(_modelSharing->scenesMutex);
+    if (_modelSharing->scenes.empty())
+        return;
+
+    std::unique_lock<std::shared_timed_mutex> renderLock(
+        _modelSharing->renderMutex);
+    for (auto scene : _modelSharing->scenes)
+        scene->copyFrom(*this);
+    ++_modelSharing->generation;
+    _modelSharing->scenes.clear();
+}
+
+bool Scene::_hasModelSharers() const
+{
+    if (!_modelSharing)
+        return false;
+
+    std::lock_guard<std::mutex> lock(_modelSharing->scenesMutex);
+    return !_modelSharing->scenes.empty();
+}
+
+bool Scene::_hasPendingModelChanges() const
+{
+    if (_volumeParameters.isModified())
+        return true;
+
+    auto lock = acquireReadAccess();
+    for (const auto& modelDescriptor : _modelDescriptors)
+        if (modelDescriptor->getModel().hasPendingChanges())
+            return true;
+    return false;
+}
+
+void Scene::_releaseSharedModels()
+{
+    if (!_sharedModels)
+        return;
+
+    std::lock_guard<std::mutex> lock(_sharedModels->scenesMutex);
+    auto& scenes = _sharedModels->scenes;
+    scenes.erase(std::remove(scenes.begin(), scenes.end(), this),
+                 scenes.end());
+}
+
 void Scene::commit()
 {
 }
@@ -236,6 +353,25 @@ ModelDescriptorPtr Scene::loadModel(Blob&& blob, const ModelParams& params,
     return modelDescriptor;
 }
 
+ModelDescriptorPtr Scene::loadModel(BlobStream& stream,
+                                    const ModelParams& params,
+                                    LoaderProgress cb)
+{
+    const auto& loader =
+        _loaderRegistry.getSuitableLoader("", stream.getType(),
+                                          params.getLoaderName());
+
+    // HACK: Add loader name in properties for archive loader
+    auto propCopy = params.getLoaderProperties();
+    propCopy.setProperty({"loaderName", params.getLoaderName()});
+    auto modelDescriptor = loader.importFromStream(stream, cb, propCopy);
+    if (!modelDescriptor)
+        throw std::runtime_error("No model returned by loader");
+    *modelDescriptor = params;
+    addModel(modelDescriptor);
+    return modelDescriptor;
+}
+
 ModelDescriptorPtr Scene::loadModel(const std::string& path,
                                     const ModelParams& params,
                                     LoaderProgress cb)
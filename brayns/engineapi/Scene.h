@@ -70,6 +70,8 @@ public:
                      GeometryParameters& geometryParameters,
                      VolumeParameters& volumeParameters);
 
+    BRAYNS_API ~Scene();
+
     /**
         Returns the bounding box of the scene
     */
@@ -169,6 +171,17 @@ public:
     ModelDescriptorPtr loadModel(Blob&& blob, const ModelParams& params,
                                  LoaderProgress cb);
 
+    /**
+     * Load the model from the given blob stream while it is being received.
+     *
+     * @param stream the stream of the blob containing the data to import
+     * @param params Parameters for the model to be loaded
+     * @param cb the callback for progress updates from the loader
+     * @return the model that has been added to the scene
+     */
+    ModelDescriptorPtr loadModel(BlobStream& stream, const ModelParams& params,
+                                 LoaderProgress cb);
+
     /**
      * Load the model from the given file.
      *
@@ -193,9 +206,59 @@ public:
     /** @internal */
     BRAYNS_API void copyFrom(const Scene& rhs);
 
+    /**
+     * @internal Render the models of the given scene as rhs committed them
+     * instead of cloning them like copyFrom(), e.g. for snapshots. Must be
+     * called from the thread committing rhs.
+     *
+     * The models stay shared until rhs is about to change them in its next
+     * commit; rhs then waits for the current frame of this scene and copies
+     * itself into this scene via copyFrom(). Hence all commits and frames of
+     * this scene must hold acquireRenderAccess(), and check sharesModels() to
+     * pick up the copy.
+     *
+     * Falls back to copyFrom() if the engine does not support sharing models
+     * between scenes, or if rhs has uncommitted model changes.
+     */
+    BRAYNS_API void shareModelsFrom(Scene& rhs);
+
+    /**
+     * @internal Keeps the scene whose models are shared via shareModelsFrom()
+     * from changing them. Does not lock anything for scenes owning their
+     * models.
+     */
+    BRAYNS_API std::shared_lock<std::shared_timed_mutex> acquireRenderAccess()
+        const;
+
+    /**
+     * @internal @return True if this scene still renders the models shared via
+     * shareModelsFrom(), false if it owns its models or got a copy of them
+     * since. Must be called with acquireRenderAccess() held.
+     */
+    BRAYNS_API bool sharesModels() const;
+
+    /**
+     * @internal Give each scene sharing the models of this scene a copy of
+     * them, so they can be changed while the other scenes keep rendering.
+     */
+    BRAYNS_API void stopSharingModels();
+
 protected:
     /** @return True if this scene supports scene updates from any thread. */
     virtual bool supportsConcurrentSceneUpdates() const { return false; }
+    /** @return True if this scene can render models owned by another scene. */
+    virtual bool supportsModelSharing() const { return false; }
+    /**
+     * Build the engine objects referencing the models shared from another
+     * scene, called by shareModelsFrom() from the thread of the owner.
+     */
+    virtual void _commitSharedModels() {}
+    /** @return True if scenes render the models of this scene. */
+    bool _hasModelSharers() const;
+    /** @return True if the next commit changes any model or volume. */
+    bool _hasPendingModelChanges() const;
+    /** Stop rendering shared models, needed before destroying this scene. */
+    void _releaseSharedModels();
     void _computeBounds();
     void _loadIBLMaps(const std::string& envMap);
 
@@ -217,6 +280,14 @@ protected:
     Boxd _bounds;
 
 private:
+    struct ModelSharing;
+    // The scenes this scene shares its models with, see shareModelsFrom()
+    std::shared_ptr<ModelSharing> _modelSharing;
+    // The sharing of the scene whose models this scene renders, which is
+    // still valid for as long as its generation is the one we shared
+    std::shared_ptr<ModelSharing> _sharedModels;
+    size_t _sharedGeneration{0};
+
     SERIALIZATION_FRIEND(Scene)
 };
 } // namespace brayns
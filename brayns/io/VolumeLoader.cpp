@@ -24,6 +24,7 @@
 #include <brayns/common/utils/utils.h>
 #include <brayns/engineapi/Model.h>
 #include <brayns/engineapi/Scene.h>
+#include <brayns/engineapi/BrickedVolume.h>
 #include <brayns/engineapi/SharedDataVolume.h>
 
 #include <fstream>
@@ -50,6 +51,9 @@ namespace brayns
 {
 namespace
 {
+// size in bytes of the bricks copied into streamed volumes
+const size_t STREAM_BRICK_SIZE = 16 * 1024 * 1024;
+
 template <size_t M, typename T>
 std::string to_string(const glm::vec<M, T>& vec)
 {
@@ -125,6 +129,26 @@ DataType dataTypeFromMET(const std::string& type)
         throw std::runtime_error("Unknown data type " + type);
 }
 
+size_t dataTypeSize(const DataType type)
+{
+    switch (type)
+    {
+    case DataType::UINT8:
+    case DataType::INT8:
+        return 1;
+    case DataType::UINT16:
+    case DataType::INT16:
+        return 2;
+    case DataType::UINT32:
+    case DataType::INT32:
+    case DataType::FLOAT:
+        return 4;
+    case DataType::DOUBLE:
+    default:
+        return 8;
+    }
+}
+
 Vector2f dataRangeFromType(DataType type)
 {
     switch (type)
@@ -170,9 +194,54 @@ ModelDescriptorPtr RawVolumeLoader::importFromBlob(
     Blob&& blob, const LoaderProgress& callback,
     const PropertyMap& properties) const
 {
-    return _loadVolume(blob.name, callback, properties, [&blob](auto volume) {
-        volume->mapData(std::move(blob.data));
-    });
+    return _loadVolume(blob.name, callback, properties,
+                       [&blob](Model& model, const Vector3ui& dimensions,
+                               const Vector3f& spacing, const DataType type) {
+                           auto volume =
+                               model.createSharedDataVolume(dimensions, spacing,
+                                                            type);
+                           volume->mapData(std::move(blob.data));
+                           return volume;
+                       });
+}
+
+ModelDescriptorPtr RawVolumeLoader::importFromStream(
+    BlobStream& stream, const LoaderProgress& callback,
+    const PropertyMap& properties) const
+{
+    // the volume properties are validated before the voxels have arrived,
+    // which are then copied into the volume brick by brick as they are
+    // received, so the complete blob is never buffered
+    return _loadVolume(
+        stream.getName(), callback, properties,
+        [&stream, &callback](Model& model, const Vector3ui& dimensions,
+                             const Vector3f& spacing, const DataType type) {
+            auto volume = model.createBrickedVolume(dimensions, spacing, type);
+
+            const size_t sliceSize =
+                size_t(dimensions.x) * dimensions.y * dataTypeSize(type);
+            const auto slicesPerBrick = uint32_t(
+                std::max(size_t(1), STREAM_BRICK_SIZE / sliceSize));
+
+            std::vector<char> brick;
+            for (uint32_t z = 0; z < dimensions.z; z += slicesPerBrick)
+            {
+                const auto numSlices =
+                    std::min(slicesPerBrick, dimensions.z - z);
+                brick.resize(numSlices * sliceSize);
+                const auto size = stream.sgetn(brick.data(), brick.size());
+                if (size != std::streamsize(brick.size()))
+                    throw std::runtime_error(
+                        "Volume data is smaller than its dimensions");
+
+                volume->setBrick(brick.data(), {0, 0, z},
+                                 {dimensions.x, dimensions.y, numSlices});
+                callback.updateProgress("Loading voxels ...",
+                                        0.5f + 0.5f * (z + numSlices) /
+                                                   dimensions.z);
+            }
+            return volume;
+        });
 }
 
 ModelDescriptorPtr RawVolumeLoader::importFromFile(
@@ -180,13 +249,21 @@ ModelDescriptorPtr RawVolumeLoader::importFromFile(
     const PropertyMap& properties) const
 {
     return _loadVolume(filename, callback, properties,
-                       [filename](auto volume) { volume->mapData(filename); });
+                       [filename](Model& model, const Vector3ui& dimensions,
+                                  const Vector3f& spacing,
+                                  const DataType type) {
+                           auto volume =
+                               model.createSharedDataVolume(dimensions, spacing,
+                                                            type);
+                           volume->mapData(filename);
+                           return volume;
+                       });
 }
 
 ModelDescriptorPtr RawVolumeLoader::_loadVolume(
     const std::string& filename, const LoaderProgress& callback,
     const PropertyMap& propertiesTmp,
-    const std::function<void(SharedDataVolumePtr)>& mapData) const
+    const CreateVolumeFunc& createVolume) const
 {
     // Fill property map since the actual property types are known now.
     PropertyMap properties = getProperties();
@@ -206,11 +283,10 @@ ModelDescriptorPtr RawVolumeLoader::_loadVolume(
 
     const auto dataRange = dataRangeFromType(type);
     auto model = _scene.createModel();
-    auto volume = model->createSharedDataVolume(dimensions, spacing, type);
-    volume->setDataRange(dataRange);
 
     callback.updateProgress("Loading voxels ...", 0.5f);
-    mapData(volume);
+    auto volume = createVolume(*model, dimensions, spacing, type);
+    volume->setDataRange(dataRange);
 
     callback.updateProgress("Adding model ...", 1.f);
     model->addVolume(volume);
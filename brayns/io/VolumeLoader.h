@@ -61,14 +61,21 @@ public:
         Blob&& blob, const LoaderProgress& callback,
         const PropertyMap& properties) const final;
 
+    ModelDescriptorPtr importFromStream(
+        BlobStream& stream, const LoaderProgress& callback,
+        const PropertyMap& properties) const final;
+
     ModelDescriptorPtr importFromFile(
         const std::string& filename, const LoaderProgress& callback,
         const PropertyMap& properties) const final;
 
 private:
-    ModelDescriptorPtr _loadVolume(
-        const std::string& filename, const LoaderProgress& callback,
-        const PropertyMap& properties,
-        const std::function<void(SharedDataVolumePtr)>& mapData) const;
+    using CreateVolumeFunc = std::function<VolumePtr(
+        Model&, const Vector3ui&, const Vector3f&, DataType)>;
+
+    ModelDescriptorPtr _loadVolume(const std::string& filename,
+                                   const LoaderProgress& callback,
+                                   const PropertyMap& properties,
+                                   const CreateVolumeFunc& createVolume) const;
 };
 }
@@ -69,9 +69,39 @@ ModelDescriptorPtr XYZBLoader::importFromBlob(
     }
     stream.seekg(0);
 
+    return _import(stream, blob.name, numlines,
+                   [numlines](const size_t i) {
+                       return i / static_cast<float>(numlines);
+                   },
+                   callback);
+}
+
+ModelDescriptorPtr XYZBLoader::importFromStream(
+    BlobStream& stream, const LoaderProgress& callback,
+    const PropertyMap& properties BRAYNS_UNUSED) const
+{
+    BRAYNS_INFO << "Loading xyz stream " << stream.getName() << std::endl;
+
+    // the number of lines is unknown until the end of the stream, so report
+    // progress on the consumed bytes instead
+    std::istream input(&stream);
+    input.exceptions(std::ios::badbit);
+    return _import(input, stream.getName(), 0,
+                   [&stream](size_t) {
+                       return stream.getReadBytes() /
+                              static_cast<float>(stream.getSize());
+                   },
+                   callback);
+}
+
+ModelDescriptorPtr XYZBLoader::_import(
+    std::istream& stream, const std::string& blobName, const size_t numlines,
+    const std::function<float(size_t)>& progress,
+    const LoaderProgress& callback) const
+{
     auto model = _scene.createModel();
 
-    const auto name = fs::path({blob.name}).stem();
+    const auto name = fs::path({blobName}).stem();
     const auto materialId = 0;
     model->createMaterial(materialId, name);
     auto& spheres = model->getSpheres()[materialId];
@@ -83,7 +113,7 @@ ModelDescriptorPtr XYZBLoader::importFromBlob(
     size_t i = 0;
     std::string line;
     std::stringstream msg;
-    msg << "Loading " << string_utils::shortenString(blob.name) << " ...";
+    msg << "Loading " << string_utils::shortenString(blobName) << " ...";
     while (std::getline(stream, line))
     {
         std::vector<float> lineData;
@@ -108,15 +138,16 @@ ModelDescriptorPtr XYZBLoader::importFromBlob(
             throw std::runtime_error("Invalid content in line " +
                                      std::to_string(i + 1) + ": " + line);
         }
-        callback.updateProgress(msg.str(), i++ / static_cast<float>(numlines));
+        callback.updateProgress(msg.str(), progress(i++));
     }
+    const auto numSpheres = spheres.size() - startOffset;
 
     // Find an appropriate mean radius to avoid overlaps of the spheres, see
     // https://en.wikipedia.org/wiki/Wigner%E2%80%93Seitz_radius
 
     const auto volume = glm::compMul(bbox.getSize());
     const auto density4PI =
-        4 * M_PI * numlines /
+        4 * M_PI * numSpheres /
         (volume > ALMOST_ZERO ? volume : _computeHalfArea(bbox));
 
     const double meanRadius = volume > ALMOST_ZERO
@@ -124,13 +155,13 @@ ModelDescriptorPtr XYZBLoader::importFromBlob(
                                   : std::sqrt(1 / density4PI);
 
     // resize the spheres to the new mean radius
-    for (i = 0; i < numlines; ++i)
+    for (i = 0; i < numSpheres; ++i)
         spheres[i + startOffset].radius = meanRadius;
 
     Transformation transformation;
     transformation.setRotationCenter(model->getBounds().getCenter());
     auto modelDescriptor =
-        std::make_shared<ModelDescriptor>(std::move(model), blob.name);
+        std::make_shared<ModelDescriptor>(std::move(model), blobName);
     modelDescriptor->setTransformation(transformation);
 
     Property radiusProperty("radius", meanRadius, 0., meanRadius * 2.,
@@ -39,9 +39,19 @@ public:
         Blob&& blob, const LoaderProgress& callback,
         const PropertyMap& properties) const final;
 
+    ModelDescriptorPtr importFromStream(
+        BlobStream& stream, const LoaderProgress& callback,
+        const PropertyMap& properties) const final;
+
     ModelDescriptorPtr importFromFile(
         const std::string& filename, const LoaderProgress& callback,
         const PropertyMap& properties) const final;
+
+private:
+    ModelDescriptorPtr _import(
+        std::istream& stream, const std::string& blobName, size_t numlines,
+        const std::function<float(size_t)>& progress,
+        const LoaderProgress& callback) const;
 };
 }
 
@@ -97,6 +97,15 @@ public:
 
     void togglePlayback() { _playing = !_playing; }
     bool isPlaying() const { return _playing; }
+    /**
+     * The number of simulation frames to read ahead of the current frame in
+     * playback direction, 0 to disable.
+     */
+    void setPrefetchFrames(const uint32_t numFrames)
+    {
+        _updateValue(_prefetchFrames, numFrames);
+    }
+    uint32_t getPrefetchFrames() const { return _prefetchFrames; }
 private:
     uint32_t _adjustedCurrent(const uint32_t newCurrent) const
     {
@@ -109,6 +118,7 @@ private:
     uint32_t _current{0};
     int32_t _delta{1};
     bool _playing{false};
+    uint32_t _prefetchFrames{0};
     double _dt{0};
     std::string _unit;
 
@@ -30,6 +30,7 @@ const std::string PARAM_MAX_ACCUMULATION_FRAMES = "max-accumulation-frames";
 const std::string PARAM_RENDERER = "renderer";
 const std::string PARAM_SPP = "samples-per-pixel";
 const std::string PARAM_SUBSAMPLING = "subsampling";
+const std::string PARAM_TARGET_FRAME_TIME = "target-frame-time";
 const std::string PARAM_VARIANCE_THRESHOLD = "variance-threshold";
 }
 
@@ -45,6 +46,10 @@ RenderingParameters::RenderingParameters()
          "Number of samples per pixel [uint]") //
         (PARAM_SUBSAMPLING.c_str(), po::value<uint32_t>(&_subsampling),
          "Subsampling factor [uint]") //
+        (PARAM_TARGET_FRAME_TIME.c_str(),
+         po::value<double>(&_targetFrameTime),
+         "Target interactive frame time in milliseconds for adaptive "
+         "subsampling, 0 to disable [float]") //
         (PARAM_ACCUMULATION.c_str(), po::bool_switch()->default_value(false),
          "Disable accumulation") //
         (PARAM_BACKGROUND_COLOR.c_str(), po::fixed_tokens_value<floats>(3, 3),
@@ -96,6 +101,10 @@ void RenderingParameters::print()
     BRAYNS_INFO << "Renderer                          : " << _renderer
                 << std::endl;
     BRAYNS_INFO << "Samples per pixel                 : " << _spp << std::endl;
+    BRAYNS_INFO << "Subsampling                       : " << _subsampling
+                << std::endl;
+    BRAYNS_INFO << "Target frame time [ms]            : " << _targetFrameTime
+                << std::endl;
     BRAYNS_INFO << "Background color                  : " << _backgroundColor
                 << std::endl;
     BRAYNS_INFO << "Camera                            : " << _camera
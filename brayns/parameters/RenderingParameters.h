@@ -70,6 +70,22 @@ public:
     {
         _updateValue(_subsampling, std::max(1u, subsampling));
     }
+
+    /**
+     * @return the targeted duration of an interactive frame in milliseconds.
+     */
+    double getTargetFrameTime() const { return _targetFrameTime; }
+    /**
+     * The targeted duration of an interactive frame in milliseconds. While
+     * the scene changes, the subsampling factor is raised above
+     * getSubsampling() until the measured render time fits into this budget;
+     * accumulation frames are always rendered at full resolution. Disabled if
+     * not positive.
+     */
+    void setTargetFrameTime(const double value)
+    {
+        _updateValue(_targetFrameTime, value);
+    }
     const Vector3d& getBackgroundColor() const { return _backgroundColor; }
     void setBackgroundColor(const Vector3d& value)
     {
@@ -89,7 +105,9 @@ public:
     double getVarianceThreshold() const { return _varianceThreshold; }
     /**
      * The threshold where accumulation stops if the variance error reaches this
-     * value.
+     * value. Tiles below the threshold also stop receiving samples. Disabled if
+     * not positive.
+     * @sa Renderer::hasConverged()
      */
     void setVarianceThreshold(const double value)
     {
@@ -116,6 +134,7 @@ protected:
     std::deque<std::string> _cameras;
     uint32_t _spp{1};
     uint32_t _subsampling{1};
+    double _targetFrameTime{0.};
     bool _accumulation{true};
     Vector3d _backgroundColor{0., 0., 0.};
     bool _headLight{true};
@@ -36,7 +36,8 @@ AddModelFromBlobTask::AddModelFromBlobTask(const BinaryParam& param,
 {
     _checkValidity(engine);
 
-    _blob.reserve(param.size);
+    _stream = std::make_shared<BlobStream>(param.type, param.getName(),
+                                           param.size, STREAM_CAPACITY);
 
     LoadModelFunctor functor{engine, param};
     functor.setCancelToken(_cancelToken);
@@ -46,9 +47,24 @@ AddModelFromBlobTask::AddModelFromBlobTask(const BinaryParam& param,
             progress.update(msg, w + (amount * (1.f - w)));
         });
 
-    // load data, return model descriptor or stop if blob receive was invalid
+    // load data while it is received, return model descriptor or stop if blob
+    // receive was invalid
     _finishTasks.emplace_back(_errorEvent.get_task());
-    _finishTasks.emplace_back(_chunkEvent.get_task().then(std::move(functor)));
+    _finishTasks.emplace_back(async::spawn(
+        [functor = std::move(functor), stream = _stream]() mutable {
+            // unblock the receiver if the loader stops before the end
+            try
+            {
+                auto modelDescriptor = functor(*stream);
+                stream->cancel();
+                return modelDescriptor;
+            }
+            catch (...)
+            {
+                stream->cancel();
+                throw;
+            }
+        }));
     _task = async::when_any(_finishTasks)
                 .then([&engine](async::when_any_result<
                                 std::vector<async::task<ModelDescriptorPtr>>>
@@ -61,23 +77,22 @@ AddModelFromBlobTask::AddModelFromBlobTask(const BinaryParam& param,
 void AddModelFromBlobTask::appendBlob(const std::string& blob)
 {
     // if more bytes than expected are received, error and stop
-    if (_blob.size() + blob.size() > _param.size)
+    if (_receivedBytes + blob.size() > _param.size)
     {
+        _stream->cancel();
         _errorEvent.set_exception(
             std::make_exception_ptr(INVALID_BINARY_RECEIVE));
         return;
     }
 
-    _blob.insert(_blob.end(), blob.begin(), blob.end());
-
     _receivedBytes += blob.size();
     std::stringstream msg;
     msg << "Receiving " << _param.getName() << " ...";
     progress.update(msg.str(), _progressBytes());
 
-    // if blob is complete, start the loading
-    if (_blob.size() == _param.size)
-        _chunkEvent.set({_param.type, _param.getName(), std::move(_blob)});
+    // waits while the loader lags behind by more than the stream capacity,
+    // which stops reading from the socket until the loader caught up
+    _stream->append(blob);
 }
 
 void AddModelFromBlobTask::_checkValidity(Engine& engine)
@@ -35,6 +35,7 @@ namespace brayns
 struct Chunk
 {
     std::string id;
+    bool attachment{false}; //!< binary data for a binary notification
 };
 
 struct BinaryParam : ModelParams
@@ -46,8 +47,8 @@ struct BinaryParam : ModelParams
 };
 
 /**
- * A task which receives a file blob, triggers loading of the received blob
- * and adds the loaded model to the engines' scene.
+ * A task which receives a file blob, streams it to the loader while it is
+ * received and adds the loaded model to the engines' scene.
  */
 class AddModelFromBlobTask : public Task<ModelDescriptorPtr>
 {
@@ -58,22 +59,18 @@ public:
 
 private:
     void _checkValidity(Engine& engine);
-    void _cancel() final
-    {
-        _chunkEvent.set_exception(
-            std::make_exception_ptr(async::task_canceled()));
-    }
+    void _cancel() final { _stream->cancel(); }
     float _progressBytes() const
     {
         return CHUNK_PROGRESS_WEIGHT * ((float)_receivedBytes / _param.size);
     }
 
-    async::event_task<Blob> _chunkEvent;
+    std::shared_ptr<BlobStream> _stream;
     async::event_task<ModelDescriptorPtr> _errorEvent;
     std::vector<async::task<ModelDescriptorPtr>> _finishTasks;
-    uint8_ts _blob;
     BinaryParam _param;
     size_t _receivedBytes{0};
     const float CHUNK_PROGRESS_WEIGHT{0.5f};
+    const size_t STREAM_CAPACITY{64 * 1024 * 1024};
 };
 }
@@ -44,6 +44,11 @@ ModelDescriptorPtr LoadModelFunctor::operator()(Blob&& blob)
     return _performLoad([&] { return _loadData(std::move(blob), _params); });
 }
 
+ModelDescriptorPtr LoadModelFunctor::operator()(BlobStream& stream)
+{
+    return _performLoad([&] { return _loadData(stream, _params); });
+}
+
 ModelDescriptorPtr LoadModelFunctor::operator()()
 {
     const auto& path = _params.getPath();
@@ -72,6 +77,12 @@ ModelDescriptorPtr LoadModelFunctor::_loadData(Blob&& blob,
                                         {_getProgressFunc()});
 }
 
+ModelDescriptorPtr LoadModelFunctor::_loadData(BlobStream& stream,
+                                               const ModelParams& params)
+{
+    return _engine.getScene().loadModel(stream, params, {_getProgressFunc()});
+}
+
 ModelDescriptorPtr LoadModelFunctor::_loadData(const std::string& path,
                                                const ModelParams& params)
 {
@@ -37,6 +37,7 @@ public:
     LoadModelFunctor(Engine& engine, const ModelParams& params);
     LoadModelFunctor(LoadModelFunctor&&) = default;
     ModelDescriptorPtr operator()(Blob&& blob);
+    ModelDescriptorPtr operator()(BlobStream& stream);
     ModelDescriptorPtr operator()();
 
 private:
@@ -44,6 +45,8 @@ private:
         const std::function<ModelDescriptorPtr()>& loadData);
 
     ModelDescriptorPtr _loadData(Blob&& blob, const ModelParams& params);
+    ModelDescriptorPtr _loadData(BlobStream& stream,
+                                 const ModelParams& params);
     ModelDescriptorPtr _loadData(const std::string& path,
                                  const ModelParams& params);
 
@@ -47,6 +47,8 @@ void OSPRayCamera::commit()
     osphelper::set(_camera, "dir", Vector3f(dir));
     osphelper::set(_camera, "up", Vector3f(up));
     osphelper::set(_camera, "buffer_target", getBufferTarget());
+    osphelper::set(_camera, "imageStart", getImageStart());
+    osphelper::set(_camera, "imageEnd", getImageEnd());
 
     toOSPRayProperties(*this, _camera);
 
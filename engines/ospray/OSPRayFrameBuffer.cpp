@@ -36,6 +36,7 @@ OSPFrameBufferFormat toOSPFrameBufferFormat(
     case FrameBufferFormat::rgba_i8:
         return OSP_FB_RGBA8;
     case FrameBufferFormat::rgb_f32:
+    case FrameBufferFormat::rgba_f32:
         return OSP_FB_RGBA32F;
     default:
         return OSP_FB_NONE;
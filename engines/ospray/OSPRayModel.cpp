@@ -28,6 +28,8 @@
 #include <brayns/engineapi/Scene.h>
 #include <brayns/parameters/AnimationParameters.h>
 
+#include <algorithm>
+
 namespace brayns
 {
 namespace
@@ -55,7 +57,8 @@ OSPRayModel::OSPRayModel(AnimationParameters& animationParameters,
 OSPRayModel::~OSPRayModel()
 {
     ospRelease(_ospTransferFunction);
-    ospRelease(_ospSimulationData);
+    for (auto simulationData : _ospSimulationData)
+        ospRelease(simulationData);
 
     const auto releaseAndClearGeometry = [](auto& geometryMap) {
         for (auto geom : geometryMap)
@@ -395,16 +398,16 @@ void OSPRayModel::commitGeometry()
         ospVolume->commit();
     }
 
+    // Materials, also if only those changed
+    for (auto material : _materials)
+        material.second->commit();
+
     if (!isDirty())
         return;
 
     if (!_primaryModel)
         _primaryModel = ospNewModel();
 
-    // Materials
-    for (auto material : _materials)
-        material.second->commit();
-
     // Group geometry
     if (_spheresDirty)
     {
@@ -553,12 +556,51 @@ void OSPRayModel::_commitTransferFunctionImpl(const Vector3fs& colors,
     ospCommit(_ospTransferFunction);
 }
 
+bool OSPRayModel::_commitSimulationFrameImpl(const uint32_t frame)
+{
+    if (!(_memoryManagementFlags & OSP_DATA_SHARED_BUFFER))
+        return Model::_commitSimulationFrameImpl(frame);
+
+    // With a shared buffer, the data objects use the memory of the persistent
+    // buffers. The handler puts the values into the back buffer, by handing
+    // over its frame memory or by copying, and the buffers are swapped.
+    const size_t buffer = _getSimulationBackBuffer();
+    auto& data = _simulationData[buffer];
+    if (!_simulationHandler->takeFrameData(frame, data))
+        return false;
+
+    // handed over memory needs a new data object, copies reuse the old one
+    auto& ospData = _ospSimulationData[buffer];
+    auto& memory = _ospSimulationDataMemory[buffer];
+    if (!ospData || memory.first != data.data() || memory.second != data.size())
+    {
+        ospRelease(ospData);
+        ospData = ospNewData(data.size(), OSP_FLOAT, data.data(),
+                             _memoryManagementFlags);
+        ospCommit(ospData);
+        memory = {data.data(), data.size()};
+    }
+    _simulationBuffer = buffer;
+    return true;
+}
+
 void OSPRayModel::_commitSimulationDataImpl(const float* frameData,
                                             const size_t frameSize)
 {
-    ospRelease(_ospSimulationData);
-    _ospSimulationData =
+    // Without a shared buffer (replicated mode), OSPRay copies the values when
+    // the data is created
+    const size_t buffer = _getSimulationBackBuffer();
+    auto& ospData = _ospSimulationData[buffer];
+    ospRelease(ospData);
+    ospData =
         ospNewData(frameSize, OSP_FLOAT, frameData, _memoryManagementFlags);
-    ospCommit(_ospSimulationData);
+    ospCommit(ospData);
+    _simulationBuffer = buffer;
+}
+
+size_t OSPRayModel::_getSimulationBackBuffer() const
+{
+    return _ospSimulationData[_simulationBuffer] ? 1 - _simulationBuffer
+                                                 : _simulationBuffer;
 }
 } // namespace brayns
@@ -50,7 +50,10 @@ public:
 
     void buildBoundingBox() final;
 
-    OSPData simulationData() const { return _ospSimulationData; }
+    OSPData simulationData() const
+    {
+        return _ospSimulationData[_simulationBuffer];
+    }
     OSPTransferFunction transferFunction() const
     {
         return _ospTransferFunction;
@@ -60,6 +63,7 @@ protected:
     void _commitTransferFunctionImpl(const Vector3fs& colors,
                                      const floats& opacities,
                                      const Vector2d valueRange) final;
+    bool _commitSimulationFrameImpl(uint32_t frame) final;
     void _commitSimulationDataImpl(const float* frameData,
                                    const size_t frameSize) final;
 
@@ -78,6 +82,7 @@ private:
     void _addGeometryToModel(const OSPGeometry geometry,
                              const size_t materialId);
     void _setBVHFlags();
+    size_t _getSimulationBackBuffer() const;
 
     // Models
     OSPModel _primaryModel{nullptr};
@@ -87,8 +92,13 @@ private:
     // Bounding box
     size_t _boudingBoxMaterialId{0};
 
-    // Simulation model
-    OSPData _ospSimulationData{nullptr};
+    // Simulation model, double-buffered so that a renderer can still read the
+    // previous frame while the next one is written
+    std::array<floats, 2> _simulationData;
+    std::array<OSPData, 2> _ospSimulationData{{nullptr, nullptr}};
+    // memory and size of _simulationData used by the shared data objects
+    std::array<std::pair<const float*, size_t>, 2> _ospSimulationDataMemory;
+    size_t _simulationBuffer{0};
 
     OSPTransferFunction _ospTransferFunction{nullptr};
 
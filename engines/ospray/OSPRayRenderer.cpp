@@ -78,7 +78,12 @@ void OSPRayRenderer::commit()
     }
 
     if (rendererChanged)
+    {
+        // the materials of our models are instanced again for the new
+        // renderer, which scenes sharing them must not see
+        scene->stopSharingModels();
         _createOSPRenderer();
+    }
 
     toOSPRayProperties(*this, _renderer);
 
@@ -90,7 +95,10 @@ void OSPRayRenderer::commit()
 
     if (isModified() || rendererChanged || _scene->isModified())
     {
-        _commitRendererMaterials();
+        // shared models have their materials instanced by the renderer of the
+        // scene owning them
+        if (!scene->sharesModels())
+            _commitRendererMaterials();
 
         if (auto simulationModel = scene->getSimulatedModel())
         {
@@ -121,7 +129,9 @@ void OSPRayRenderer::commit()
     }
 
     osphelper::set(_renderer, "timestamp", static_cast<float>(ap.getFrame()));
-    osphelper::set(_renderer, "randomNumber", rand() % 10000);
+    // Deterministic seed of the low-discrepancy sampler, renewed on each commit
+    osphelper::set(_renderer, "randomNumber",
+                   static_cast<int>(_commitCount++ % 10000));
     osphelper::set(_renderer, "bgColor", Vector3f(rp.getBackgroundColor()));
     osphelper::set(_renderer, "varianceThreshold",
                    static_cast<float>(rp.getVarianceThreshold()));
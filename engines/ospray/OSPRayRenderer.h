@@ -52,6 +52,7 @@ private:
     std::atomic<float> _variance{std::numeric_limits<float>::max()};
     std::string _currentOSPRenderer;
     OSPData _currLightsData{nullptr};
+    uint32_t _commitCount{0};
 
     Planes _clipPlanes;
 
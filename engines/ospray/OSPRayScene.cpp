@@ -49,6 +49,7 @@ OSPRayScene::OSPRayScene(AnimationParameters& animationParameters,
 
 OSPRayScene::~OSPRayScene()
 {
+    _releaseSharedModels();
     _destroyLights();
     if (_rootModel)
         ospRelease(_rootModel);
@@ -68,6 +69,16 @@ void OSPRayScene::commit()
     Scene::commit();
     commitLights();
 
+    // the root model referencing the shared models was built by
+    // shareModelsFrom() and must not be changed anymore
+    if (sharesModels())
+        return;
+
+    // scenes sharing our models render them as we committed them, so they
+    // continue on a copy before the models change
+    if (_hasModelSharers() && _hasPendingModelChanges())
+        stopSharingModels();
+
     // copy the list to avoid locking the mutex
     ModelDescriptors modelDescriptors;
     {
@@ -109,12 +120,7 @@ void OSPRayScene::commit()
         if (!modelDescriptor->getEnabled())
             continue;
 
-        // keep models from being deleted via removeModel() as long as we use
-        // them here
-        _activeModels.push_back(modelDescriptor);
-
         auto& impl = static_cast<OSPRayModel&>(modelDescriptor->getModel());
-        const auto& transformation = modelDescriptor->getTransformation();
 
         BRAYNS_DEBUG << "Committing " << modelDescriptor->getName()
                      << std::endl;
@@ -122,48 +128,7 @@ void OSPRayScene::commit()
         impl.commitGeometry();
         impl.logInformation();
 
-        // add volumes to root model, because scivis renderer does not consider
-        // volumes from instances
-        if (modelDescriptor->getVisible())
-        {
-            modelDescriptor->getModel().commitGeometry();
-            for (auto volume : modelDescriptor->getModel().getVolumes())
-            {
-                auto ospVolume =
-                    std::dynamic_pointer_cast<OSPRayVolume>(volume);
-                ospAddVolume(_rootModel, ospVolume->impl());
-            }
-        }
-
-        const auto& instances = modelDescriptor->getInstances();
-        for (size_t i = 0; i < instances.size(); ++i)
-        {
-            const auto& instance = instances[i];
-
-            // First instance uses model transformation
-            const auto& instanceTransform =
-                (i == 0 ? transformation : instance.getTransformation());
-
-            if (modelDescriptor->getBoundingBox() && instance.getBoundingBox())
-            {
-                // scale and move the unit-sized bounding box geometry to the
-                // model size/scale first, then apply the instance transform
-                const auto& modelBounds =
-                    modelDescriptor->getModel().getBounds();
-                Transformation modelTransform;
-                modelTransform.setTranslation(modelBounds.getCenter() -
-                                              0.5 * modelBounds.getSize());
-                modelTransform.setScale(modelBounds.getSize());
-
-                addInstance(_rootModel, impl.getBoundingBoxModel(),
-                            transformationToAffine3f(instanceTransform) *
-                                transformationToAffine3f(modelTransform));
-            }
-
-            if (modelDescriptor->getVisible() && instance.getVisible())
-                addInstance(_rootModel, impl.getPrimaryModel(),
-                            instanceTransform);
-        }
+        _addModelToRoot(modelDescriptor);
 
         impl.markInstancesClean();
     }
@@ -174,6 +139,72 @@ void OSPRayScene::commit()
     _computeBounds();
 }
 
+void OSPRayScene::_commitSharedModels()
+{
+    // the models were committed by the scene owning them, only the root model
+    // referencing them is ours
+    _activeModels.clear();
+
+    if (_rootModel)
+        ospRelease(_rootModel);
+    _rootModel = ospNewModel();
+
+    for (auto modelDescriptor : _modelDescriptors)
+        if (modelDescriptor->getEnabled())
+            _addModelToRoot(modelDescriptor);
+
+    ospCommit(_rootModel);
+}
+
+void OSPRayScene::_addModelToRoot(const ModelDescriptorPtr& modelDescriptor)
+{
+    // keep models from being deleted via removeModel() as long as we use
+    // them here
+    _activeModels.push_back(modelDescriptor);
+
+    auto& impl = static_cast<OSPRayModel&>(modelDescriptor->getModel());
+    const auto& transformation = modelDescriptor->getTransformation();
+
+    // add volumes to root model, because scivis renderer does not consider
+    // volumes from instances
+    if (modelDescriptor->getVisible())
+    {
+        for (auto volume : impl.getVolumes())
+        {
+            auto ospVolume = std::dynamic_pointer_cast<OSPRayVolume>(volume);
+            ospAddVolume(_rootModel, ospVolume->impl());
+        }
+    }
+
+    const auto& instances = modelDescriptor->getInstances();
+    for (size_t i = 0; i < instances.size(); ++i)
+    {
+        const auto& instance = instances[i];
+
+        // First instance uses model transformation
+        const auto& instanceTransform =
+            (i == 0 ? transformation : instance.getTransformation());
+
+        if (modelDescriptor->getBoundingBox() && instance.getBoundingBox())
+        {
+            // scale and move the unit-sized bounding box geometry to the
+            // model size/scale first, then apply the instance transform
+            const auto& modelBounds = modelDescriptor->getModel().getBounds();
+            Transformation modelTransform;
+            modelTransform.setTranslation(modelBounds.getCenter() -
+                                          0.5 * modelBounds.getSize());
+            modelTransform.setScale(modelBounds.getSize());
+
+            addInstance(_rootModel, impl.getBoundingBoxModel(),
+                        transformationToAffine3f(instanceTransform) *
+                            transformationToAffine3f(modelTransform));
+        }
+
+        if (modelDescriptor->getVisible() && instance.getVisible())
+            addInstance(_rootModel, impl.getPrimaryModel(), instanceTransform);
+    }
+}
+
 bool OSPRayScene::commitLights()
 {
     if (!_lightManager.isModified())
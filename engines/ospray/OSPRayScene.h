@@ -51,6 +51,8 @@ public:
 
     /** @copydoc Scene::supportsConcurrentSceneUpdates. */
     bool supportsConcurrentSceneUpdates() const final { return true; }
+    /** @copydoc Scene::supportsModelSharing. */
+    bool supportsModelSharing() const final { return true; }
     ModelPtr createModel() const final;
 
     OSPModel getModel() { return _rootModel; }
@@ -59,6 +61,8 @@ public:
 
 private:
     bool _commitVolumeAndTransferFunction(ModelDescriptors& modelDescriptors);
+    void _commitSharedModels() final;
+    void _addModelToRoot(const ModelDescriptorPtr& modelDescriptor);
     void _destroyLights();
 
     OSPModel _rootModel{nullptr};
@@ -20,6 +20,7 @@
 
 #include "OSPRayVolume.h"
 
+#include <brayns/common/volume/MacroCells.h>
 #include <brayns/parameters/VolumeParameters.h>
 #include <engines/ospray/utils.h>
 
@@ -32,9 +33,14 @@ OSPRayVolume::OSPRayVolume(const Vector3ui& dimensions, const Vector3f& spacing,
     : Volume(dimensions, spacing, type)
     , _parameters(params)
     , _volume(ospNewVolume(volumeType.c_str()))
+    , _macroCellRanges(glm::compMul(getMacroCellDimensions(dimensions)),
+                       getEmptyMacroCellRange())
 {
     osphelper::set(_volume, "dimensions", Vector3i(dimensions));
     osphelper::set(_volume, "gridSpacing", Vector3f(spacing));
+    osphelper::set(_volume, "macroCellSize", int(MACRO_CELL_SIZE));
+    osphelper::set(_volume, "macroCellDimensions",
+                   Vector3i(getMacroCellDimensions(dimensions)));
 
     switch (type)
     {
@@ -114,6 +120,7 @@ void OSPRayBrickedVolume::setBrick(const void* data, const Vector3ui& position,
     const ospcommon::vec3i size{int(size_.x), int(size_.y), int(size_.z)};
     ospSetRegion(_volume, const_cast<void*>(data), (osp::vec3i&)pos,
                  (osp::vec3i&)size);
+    _updateMacroCells(data, position, size_);
     BrickedVolume::_sizeInBytes += glm::compMul(size_) * _dataSize;
     markModified();
 }
@@ -126,9 +133,20 @@ void OSPRaySharedDataVolume::setVoxels(const void* voxels)
         glm::compMul(SharedDataVolume::_dimensions) * _dataSize;
     ospSetData(_volume, "voxelData", data);
     ospRelease(data);
+    _updateMacroCells(voxels, {0, 0, 0}, SharedDataVolume::_dimensions);
     markModified();
 }
 
+void OSPRayVolume::_updateMacroCells(const void* data,
+                                     const Vector3ui& position,
+                                     const Vector3ui& size)
+{
+    std::lock_guard<std::mutex> lock(_macroCellsMutex);
+    updateMacroCellRanges(data, _dataType, position, size, _dimensions,
+                          _macroCellRanges);
+    _macroCellsModified = true;
+}
+
 void OSPRayVolume::commit()
 {
     if (_parameters.isModified())
@@ -152,6 +170,18 @@ void OSPRayVolume::commit()
         osphelper::set(_volume, "volumeClippingBoxUpper",
                        Vector3f(_parameters.getClipBox().getMax()));
     }
+    {
+        std::lock_guard<std::mutex> lock(_macroCellsMutex);
+        if (_macroCellsModified)
+        {
+            // copied, as bricks may still arrive during rendering
+            OSPData data = ospNewData(_macroCellRanges.size(), OSP_FLOAT2,
+                                      _macroCellRanges.data());
+            ospSetData(_volume, "macroCellRanges", data);
+            ospRelease(data);
+            _macroCellsModified = false;
+        }
+    }
     if (isModified() || _parameters.isModified())
         ospCommit(_volume);
     resetModified();
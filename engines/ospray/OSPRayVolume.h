@@ -25,6 +25,8 @@
 
 #include <ospray/SDK/volume/Volume.h>
 
+#include <mutex>
+
 namespace brayns
 {
 class OSPRayVolume : public virtual Volume
@@ -41,10 +43,20 @@ public:
 
     OSPVolume impl() const { return _volume; }
 protected:
+    /** Extend the macro cell value ranges by the given brick of voxels. */
+    void _updateMacroCells(const void* data, const Vector3ui& position,
+                           const Vector3ui& size);
+
     size_t _dataSize{0};
     const VolumeParameters& _parameters;
     OSPVolume _volume;
     OSPDataType _ospType;
+
+private:
+    // updated by bricks uploaded from other threads while rendering
+    std::mutex _macroCellsMutex;
+    Vector2fs _macroCellRanges;
+    bool _macroCellsModified{false};
 };
 
 class OSPRayBrickedVolume : public BrickedVolume, public OSPRayVolume
@@ -221,6 +221,12 @@ const brayns::Property PROP_USER_DATA_TYPE = {
     {"Type of data attached to morphology segments"}};
 const brayns::Property PROP_SYNCHRONOUS_MODE = {
     "023SynchronousMode", false, {"Synchronous mode"}};
+const brayns::Property PROP_FRAME_CACHE_FOLDER = {
+    "024FrameCacheFolder", std::string(),
+    {"Local folder to cache simulation frames in, disabled if empty"}};
+const brayns::Property PROP_FRAME_CACHE_SIZE = {
+    "025FrameCacheSize", 1024,
+    {"Maximum size of the simulation frame cache in MB"}};
 const brayns::Property PROP_CIRCUIT_COLOR_SCHEME = {
     "030CircuitColorScheme", enumToString(CircuitColorScheme::none),
     enumerateNames<CircuitColorScheme>(),
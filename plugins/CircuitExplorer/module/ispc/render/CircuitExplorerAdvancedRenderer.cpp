@@ -27,12 +27,21 @@
 // ospray
 #include <ospray/SDK/common/Data.h>
 #include <ospray/SDK/common/Model.h>
+#include <ospray/SDK/lights/DirectionalLight.h>
+#include <ospray/SDK/transferFunction/TransferFunction.h>
+#include <ospray/SDK/volume/Volume.h>
 
 // ispc exports
 #include "CircuitExplorerAdvancedRenderer_ispc.h"
 
 using namespace ospray;
 
+namespace
+{
+// Distance between the points of volume shadow grids, in voxels
+const int SHADOW_GRID_CELL_SIZE = 4;
+} // namespace
+
 namespace circuitExplorer
 {
 void CircuitExplorerAdvancedRenderer::commit()
@@ -53,6 +62,8 @@ void CircuitExplorerAdvancedRenderer::commit()
     _volumeSamplesPerRay = getParam1i("volumeSamplesPerRay", 32);
     _volumeSpecularExponent = getParam1f("volumeSpecularExponent", 20.f);
     _volumeAlphaCorrection = getParam1f("volumeAlphaCorrection", 0.5f);
+    _emptySpaceSkipping = getParam("emptySpaceSkipping", 1);
+    _volumeShadowGrids = getParam("volumeShadowGrids", 0);
 
     const uint64 simulationDataSize =
         _simulationData ? _simulationData->size() : 0;
@@ -73,6 +84,53 @@ void CircuitExplorerAdvancedRenderer::commit()
         _volumeAlphaCorrection, _exposure, _fogThickness, _fogStart,
         (const ispc::vec4f*)clipPlaneData, numClipPlanes, _maxBounces,
         _epsilonFactor, _useHardwareRandomizer);
+
+    _commitMacroCells();
+    _commitShadowGrids();
+}
+
+void CircuitExplorerAdvancedRenderer::_commitMacroCells()
+{
+    // The macro cell value ranges are computed by the volumes when their
+    // voxels are set. Which cells are empty depends on the transfer function
+    // and the sampling threshold, so this is redone on every commit.
+    const size_t numVolumes = model ? model->volume.size() : 0;
+    _emptyMacroCells.resize(numVolumes);
+    _emptyMacroCellPtrs.assign(numVolumes, nullptr);
+    _macroCellDimensions.resize(numVolumes);
+    _macroCellOrigins.resize(numVolumes);
+    _macroCellSizes.resize(numVolumes);
+
+    for (size_t i = 0; i < numVolumes && _emptySpaceSkipping; ++i)
+    {
+        Volume* volume = model->volume[i].ptr;
+        Data* ranges = volume->getParamData("macroCellRanges", nullptr);
+        const vec3i dimensions =
+            volume->getParam3i("macroCellDimensions", vec3i(0));
+        const int cellSize = volume->getParam1i("macroCellSize", 0);
+        const size_t numCells =
+            size_t(dimensions.x) * dimensions.y * dimensions.z;
+        if (!ranges || cellSize == 0 || ranges->numItems != numCells)
+            continue;
+
+        auto& emptyCells = _emptyMacroCells[i];
+        emptyCells.resize(numCells);
+        ispc::CircuitExplorerAdvancedRenderer_computeEmptyMacroCells(
+            volume->getIE(), (const ispc::vec2f*)ranges->data, numCells,
+            _samplingThreshold, emptyCells.data());
+
+        _emptyMacroCellPtrs[i] = emptyCells.data();
+        _macroCellDimensions[i] = dimensions;
+        _macroCellOrigins[i] = volume->getParam3f("gridOrigin", vec3f(0.f));
+        _macroCellSizes[i] =
+            volume->getParam3f("gridSpacing", vec3f(1.f)) * float(cellSize);
+    }
+
+    ispc::CircuitExplorerAdvancedRenderer_setMacroCells(
+        getIE(), _emptyMacroCellPtrs.data(),
+        (const ispc::vec3i*)_macroCellDimensions.data(),
+        (const ispc::vec3f*)_macroCellOrigins.data(),
+        (const ispc::vec3f*)_macroCellSizes.data(), numVolumes);
 }
 
 CircuitExplorerAdvancedRenderer::CircuitExplorerAdvancedRenderer()
@@ -80,6 +138,101 @@ CircuitExplorerAdvancedRenderer::CircuitExplorerAdvancedRenderer()
     ispcEquivalent = ispc::CircuitExplorerAdvancedRenderer_create(this);
 }
 
+void CircuitExplorerAdvancedRenderer::_commitShadowGrids()
+{
+    // Shadow rays are marched from the grid points towards each directional
+    // light, which is too slow to redo on every commit
+    const size_t numVolumes =
+        model && _volumeShadowGrids ? model->volume.size() : 0;
+    const size_t numLights = _lightData ? _lightData->size() : 0;
+    _shadowGrids.resize(numVolumes * numLights);
+    _shadowGridPtrs.assign(_shadowGrids.size(), nullptr);
+    _shadowGridDimensions.resize(numVolumes);
+    _shadowGridOrigins.resize(numVolumes);
+    _shadowGridCellSizes.resize(numVolumes);
+
+    for (size_t i = 0; i < numVolumes; ++i)
+    {
+        Volume* volume = model->volume[i].ptr;
+        auto transferFunction = (TransferFunction*)volume->getParamObject(
+            "transferFunction", nullptr);
+        const vec3i voxels = volume->getParam3i("dimensions", vec3i(0));
+        if (!transferFunction || reduce_min(voxels) < 2)
+            continue;
+
+        const vec3i dimensions =
+            (voxels + SHADOW_GRID_CELL_SIZE - 2) / SHADOW_GRID_CELL_SIZE + 1;
+        const vec3f origin = volume->getParam3f("gridOrigin", vec3f(0.f));
+        const vec3f cellSize = volume->getParam3f("gridSpacing", vec3f(1.f)) *
+                               float(SHADOW_GRID_CELL_SIZE);
+        _shadowGridDimensions[i] = dimensions;
+        _shadowGridOrigins[i] = origin;
+        _shadowGridCellSizes[i] = cellSize;
+
+        Data* macroCellRanges =
+            volume->getParamData("macroCellRanges", nullptr);
+        Data* opacities = transferFunction->getParamData("opacities", nullptr);
+        const vec2f valueRange =
+            transferFunction->getParam2f("valueRange", vec2f(0.f, 1.f));
+        const float samplingRate = volume->getParam1f("samplingRate", 0.125f);
+
+        for (size_t j = 0; j < numLights; ++j)
+        {
+            Light* light = ((Light**)_lightData->data)[j];
+            if (!dynamic_cast<DirectionalLight*>(light))
+                continue;
+
+            const vec3f lightDirection = -normalize(
+                light->getParam3f("direction", vec3f(0.f, 0.f, 1.f)));
+
+            auto& grid = _shadowGrids[i * numLights + j];
+            const bool modified =
+                grid.volume != volume ||
+                grid.lightDirection != lightDirection ||
+                grid.macroCellRanges.ptr != macroCellRanges ||
+                grid.opacities.ptr != opacities ||
+                grid.valueRange != valueRange ||
+                grid.samplingRate != samplingRate ||
+                grid.samplingThreshold != _samplingThreshold ||
+                grid.clipPlanes.ptr != clipPlanes.ptr;
+            if (modified)
+            {
+                // The references keep the data alive, so that a changed input
+                // cannot have the same address
+                grid.volume = volume;
+                grid.lightDirection = lightDirection;
+                grid.macroCellRanges = macroCellRanges;
+                grid.opacities = opacities;
+                grid.valueRange = valueRange;
+                grid.samplingRate = samplingRate;
+                grid.samplingThreshold = _samplingThreshold;
+                grid.clipPlanes = clipPlanes;
+
+                PLUGIN_DEBUG << "Computing volume shadow grid of light " << j
+                             << std::endl;
+                grid.values.resize(size_t(dimensions.x) * dimensions.y *
+                                   dimensions.z);
+#pragma omp parallel for
+                for (int z = 0; z < dimensions.z; ++z)
+                    ispc::CircuitExplorerAdvancedRenderer_computeShadowGridSlab(
+                        getIE(), volume->getIE(), i,
+                        (const ispc::vec3f&)lightDirection,
+                        (const ispc::vec3i&)dimensions,
+                        (const ispc::vec3f&)origin,
+                        (const ispc::vec3f&)cellSize, z, grid.values.data());
+            }
+            _shadowGridPtrs[i * numLights + j] = grid.values.data();
+        }
+    }
+
+    ispc::CircuitExplorerAdvancedRenderer_setShadowGrids(
+        getIE(), _shadowGridPtrs.data(),
+        (const ispc::vec3i*)_shadowGridDimensions.data(),
+        (const ispc::vec3f*)_shadowGridOrigins.data(),
+        (const ispc::vec3f*)_shadowGridCellSizes.data(), numVolumes,
+        numLights);
+}
+
 OSP_REGISTER_RENDERER(CircuitExplorerAdvancedRenderer,
                       circuit_explorer_advanced);
 } // namespace circuitExplorer
@@ -23,6 +23,8 @@
 
 #include "utils/CircuitExplorerSimulationRenderer.h"
 
+#include <ospray/SDK/common/Data.h>
+
 namespace circuitExplorer
 {
 /**
@@ -46,6 +48,9 @@ public:
     void commit() final;
 
 private:
+    void _commitMacroCells();
+    void _commitShadowGrids();
+
     // Shading
     float _shadows{0.f};
     float _softShadows{0.f};
@@ -64,6 +69,36 @@ private:
     float _volumeSpecularExponent{10.f};
     float _volumeAlphaCorrection{0.5f};
 
+    // Empty space skipping, one macro cell grid per volume of the model
+    bool _emptySpaceSkipping{true};
+    std::vector<std::vector<ospray::uint8>> _emptyMacroCells;
+    std::vector<const ospray::uint8*> _emptyMacroCellPtrs;
+    std::vector<ospray::vec3i> _macroCellDimensions;
+    std::vector<ospray::vec3f> _macroCellOrigins;
+    std::vector<ospray::vec3f> _macroCellSizes;
+
+    // Precomputed volume shadows, one grid per volume and directional light.
+    // A grid is only recomputed if one of the inputs it was computed with
+    // changes.
+    struct ShadowGrid
+    {
+        ospray::Volume* volume{nullptr};
+        ospray::vec3f lightDirection;
+        ospray::Ref<ospray::Data> macroCellRanges;
+        ospray::Ref<ospray::Data> opacities;
+        ospray::vec2f valueRange;
+        float samplingRate{0.f};
+        float samplingThreshold{0.f};
+        ospray::Ref<ospray::Data> clipPlanes;
+        std::vector<float> values;
+    };
+    bool _volumeShadowGrids{false};
+    std::vector<ShadowGrid> _shadowGrids;
+    std::vector<const float*> _shadowGridPtrs;
+    std::vector<ospray::vec3i> _shadowGridDimensions;
+    std::vector<ospray::vec3f> _shadowGridOrigins;
+    std::vector<ospray::vec3f> _shadowGridCellSizes;
+
     // Clip planes
     ospray::Ref<ospray::Data> clipPlanes;
 };
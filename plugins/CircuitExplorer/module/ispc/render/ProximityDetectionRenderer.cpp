@@ -35,6 +35,7 @@ void ProximityDetectionRenderer::commit()
     _detectionDistance = getParam1f("detectionDistance", 1.f);
     _detectionOnDifferentMaterial =
         bool(getParam1i("detectionOnDifferentMaterial", 1));
+    _detectionSamples = getParam1i("detectionSamples", 4);
     _surfaceShadingEnabled = bool(getParam1i("surfaceShadingEnabled", 1));
     _randomNumber = getParam1i("randomNumber", 0);
     _alphaCorrection = getParam1f("alphaCorrection", 0.5f);
@@ -42,9 +43,9 @@ void ProximityDetectionRenderer::commit()
     ispc::ProximityDetectionRenderer_set(
         getIE(), (_bgMaterial ? _bgMaterial->getIE() : nullptr),
         (ispc::vec3f&)_nearColor, (ispc::vec3f&)_farColor, _detectionDistance,
-        _detectionOnDifferentMaterial, _randomNumber, _timestamp, spp,
-        _surfaceShadingEnabled, _lightPtr, _lightArray.size(), _alphaCorrection,
-        _maxBounces, _exposure, _useHardwareRandomizer);
+        _detectionOnDifferentMaterial, _detectionSamples, _randomNumber,
+        _timestamp, spp, _surfaceShadingEnabled, _lightPtr, _lightArray.size(),
+        _alphaCorrection, _maxBounces, _exposure, _useHardwareRandomizer);
 }
 
 ProximityDetectionRenderer::ProximityDetectionRenderer()
@@ -35,13 +35,16 @@ namespace circuitExplorer
    detection distance. farColor is used otherwise. The dection distance defines
    the maximum distance between the intersection and the surrounding geometry.
 
-    Surrounding geometry is detected by sending random rays from the
-    intersection point of the surface.
+    Surrounding geometry is detected by sending several stratified rays from
+    the intersection point of the surface in every frame. The rays of
+    successive frames follow a low-discrepancy sequence so that accumulated
+    frames keep refining the estimate instead of repeating directions.
 
     This renderer can be configured using the following entries:
     - detectionDistance: Maximum distance for surrounding geometry detection
     - materialTestEnabled: If true, detection will be disabled for geometry that
     has the same material as the hit surface.
+    - detectionSamples: Number of detection rays per intersection and frame
     - spp: Unsigned integer defining the number of samples per pixel
 */
 class ProximityDetectionRenderer : public CircuitExplorerAbstractRenderer
@@ -65,6 +68,7 @@ private:
     ospray::vec3f _farColor{1.f, 0.f, 0.f};
     float _detectionDistance{1.f};
     bool _detectionOnDifferentMaterial{true};
+    int _detectionSamples{4};
     bool _surfaceShadingEnabled{true};
     ospray::uint32 _randomNumber{0};
     float _alphaCorrection{0.5f};
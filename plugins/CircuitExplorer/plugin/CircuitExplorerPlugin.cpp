@@ -40,6 +40,7 @@
 #include <brayns/common/Progress.h>
 #include <brayns/common/Timer.h>
 #include <brayns/common/geometry/Streamline.h>
+#include <brayns/common/utils/binaryUtils.h>
 #include <brayns/common/utils/imageUtils.h>
 #include <brayns/engineapi/Camera.h>
 #include <brayns/engineapi/Engine.h>
@@ -97,6 +98,13 @@ void _addAdvancedSimulationRenderer(brayns::Engine& engine)
                             {"Volume specular exponent"}});
     properties.setProperty(
         {"volumeAlphaCorrection", 0.5, 0.001, 1., {"Volume alpha correction"}});
+    properties.setProperty({"emptySpaceSkipping",
+                            true,
+                            {"Skip transparent regions of volumes"}});
+    properties.setProperty(
+        {"volumeShadowGrids",
+         false,
+         {"Precompute volume shadows of directional lights"}});
     properties.setProperty({"maxDistanceToSecondaryModel",
                             30.,
                             0.1,
@@ -196,6 +204,8 @@ void _addProximityRenderer(brayns::Engine& engine)
     properties.setProperty({"detectionOnDifferentMaterial",
                             false,
                             {"Detection on different material"}});
+    properties.setProperty(
+        {"detectionSamples", 4, 1, 64, {"Detection samples per frame"}});
     properties.setProperty(
         {"surfaceShadingEnabled", true, {"Surface shading"}});
     properties.setProperty(
@@ -333,8 +343,26 @@ void CircuitExplorerPlugin::init()
             [&](const MaterialsDescriptor& param) { _setMaterials(param); });
 
         PLUGIN_INFO << "Registering 'set-material-range' endpoint" << std::endl;
-        actionInterface->registerNotification<MaterialRangeDescriptor>(
-            "set-material-range", [&](const MaterialRangeDescriptor& param) {
+        actionInterface->registerBinaryNotification<MaterialRangeDescriptor>(
+            "set-material-range",
+            [&](MaterialRangeDescriptor param,
+                const brayns::uint8_ts& attachment) {
+                // Diffuse colors can be sent as a binary attachment of
+                // float32 RGB triplets instead of a JSON array
+                if (!attachment.empty())
+                {
+                    if (attachment.size() % (3 * sizeof(float)) != 0)
+                    {
+                        PLUGIN_ERROR << "set-material-range: The diffuse "
+                                        "colors attachment is not made of "
+                                        "float RGB triplets"
+                                     << std::endl;
+                        return;
+                    }
+                    brayns::BinaryReader reader(attachment);
+                    param.diffuseColor = reader.readArray<float>(
+                        attachment.size() / sizeof(float));
+                }
                 _setMaterialRange(param);
             });
 
@@ -530,9 +558,8 @@ void CircuitExplorerPlugin::_setMaterial(const MaterialDescriptor& md)
                                          md.clippingMode);
                 material->updateProperty(MATERIAL_PROPERTY_USER_PARAMETER,
                                          static_cast<double>(md.userParameter));
-                material->markModified(); // This is needed to apply
-                                          // propery modifications
-                material->commit();
+                material->markModified(); // Applied by the next
+                                          // scene commit
 
                 _dirty = true;
             }
@@ -612,9 +639,8 @@ void CircuitExplorerPlugin::_setMaterials(const MaterialsDescriptor& md)
                             material->updateProperty(
                                 MATERIAL_PROPERTY_USER_PARAMETER,
                                 static_cast<double>(md.userParameters[id]));
-                        material->markModified(); // This is needed to apply
-                                                  // propery modifications
-                        material->commit();
+                        material->markModified(); // Applied by the next
+                                                  // scene commit
                     }
                 }
                 catch (const std::runtime_error& e)
@@ -693,9 +719,8 @@ void CircuitExplorerPlugin::_setMaterialRange(
                     material->updateProperty(MATERIAL_PROPERTY_USER_PARAMETER,
                                              static_cast<double>(
                                                  mrd.userParameter));
-                    material->markModified(); // This is needed to apply
-                                              // propery modifications
-                    material->commit();
+                    material->markModified(); // Applied by the next
+                                              // scene commit
                 }
             }
             catch (const std::runtime_error& e)
@@ -799,16 +824,21 @@ void CircuitExplorerPlugin::_setConnectionsPerValue(
             return;
         }
 
+        brayns::uint8_ts selected;
+        if (!simulationHandler->selectValues(cpv.frame, cpv.value, cpv.epsilon,
+                                             selected))
+        {
+            PLUGIN_ERROR << "Simulation frame " << cpv.frame
+                         << " is not loaded" << std::endl;
+            return;
+        }
+
         auto& model = modelDescriptor->getModel();
         for (const auto& spheres : model.getSpheres())
         {
             for (const auto& s : spheres.second)
             {
-                const float* data = static_cast<float*>(
-                    simulationHandler->getFrameData(cpv.frame));
-
-                const float value = data[s.userData];
-                if (abs(value - cpv.value) < cpv.epsilon)
+                if (s.userData < selected.size() && selected[s.userData])
                     pointCloud[spheres.first].push_back(
                         {s.center.x, s.center.y, s.center.z, s.radius});
             }
@@ -853,16 +883,21 @@ void CircuitExplorerPlugin::_setMetaballsPerSimulationValue(
             return;
         }
 
+        brayns::uint8_ts selected;
+        if (!simulationHandler->selectValues(mpsv.frame, mpsv.value,
+                                             mpsv.epsilon, selected))
+        {
+            PLUGIN_ERROR << "Simulation frame " << mpsv.frame
+                         << " is not loaded" << std::endl;
+            return;
+        }
+
         auto& model = modelDescriptor->getModel();
         for (const auto& spheres : model.getSpheres())
         {
             for (const auto& s : spheres.second)
             {
-                const float* data = static_cast<float*>(
-                    simulationHandler->getFrameData(mpsv.frame));
-
-                const float value = data[s.userData];
-                if (abs(value - mpsv.value) < mpsv.epsilon)
+                if (s.userData < selected.size() && selected[s.userData])
                     pointCloud[spheres.first].push_back(
                         {s.center.x, s.center.y, s.center.z, s.radius});
             }
@@ -206,6 +206,10 @@ CompartmentReportPtr AbstractCircuitLoader::_attachSimulationHandler(
         properties.getProperty<std::string>(PROP_DB_CONNECTION_STRING.name);
     const auto synchronousMode =
         !properties.getProperty<bool>(PROP_SYNCHRONOUS_MODE.name);
+    const auto frameCacheFolder =
+        properties.getProperty<std::string>(PROP_FRAME_CACHE_FOLDER.name);
+    const uint64_t frameCacheSize =
+        properties.getProperty<int>(PROP_FRAME_CACHE_SIZE.name);
 
     brayns::AbstractSimulationHandlerPtr simulationHandler{nullptr};
     switch (reportType)
@@ -217,9 +221,9 @@ CompartmentReportPtr AbstractCircuitLoader::_attachSimulationHandler(
                     << std::endl;
         const auto &voltageReport = blueConfiguration.getReportSource(report);
         PLUGIN_INFO << "Voltage report: " << voltageReport << std::endl;
-        auto handler =
-            std::make_shared<VoltageSimulationHandler>(voltageReport.getPath(),
-                                                       gids, synchronousMode);
+        auto handler = std::make_shared<VoltageSimulationHandler>(
+            voltageReport.getPath(), gids, synchronousMode, frameCacheFolder,
+            frameCacheSize * 1024 * 1024);
         compartmentReport = handler->getReport();
 
         // Only keep simulated GIDs
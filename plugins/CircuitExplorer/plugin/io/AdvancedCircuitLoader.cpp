@@ -64,6 +64,8 @@ brayns::PropertyMap AdvancedCircuitLoader::getCLIProperties()
     pm.setProperty(PROP_REPORT);
     pm.setProperty(PROP_REPORT_TYPE);
     pm.setProperty(PROP_SYNCHRONOUS_MODE);
+    pm.setProperty(PROP_FRAME_CACHE_FOLDER);
+    pm.setProperty(PROP_FRAME_CACHE_SIZE);
     pm.setProperty(PROP_TARGETS);
     pm.setProperty(PROP_GIDS);
     pm.setProperty(PROP_CIRCUIT_COLOR_SCHEME);
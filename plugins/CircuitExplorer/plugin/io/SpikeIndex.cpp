@@ -0,0 +1,64 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of the circuit explorer for Brayns
+ * <https://github.com/favreau/Brayns-UC-CircuitExplorer>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "SpikeIndex.h"
+
+#include <brayns/common/simulation/FrameTransforms.h>
+
+#include <algorithm>
+#include <limits>
+
+void SpikeIndex::computeFrame(const float start, const float end,
+                              const uint32_t frame, const float dt,
+                              const Values& values, float* data) const
+{
+    const int64_t nbCells = getNbCells();
+
+    // frames elapsed since each cell last spiked, the decay is applied to all
+    // cells at once below
+#pragma omp parallel for
+    for (int64_t cell = 0; cell < nbCells; ++cell)
+    {
+        const auto first = _times.begin() + _offsets[cell];
+        const auto last = _times.begin() + _offsets[cell + 1];
+
+        // the last spike before the end of the window
+        const auto spike = std::lower_bound(first, last, end);
+        if (spike == first)
+        {
+            data[cell] = std::numeric_limits<float>::infinity();
+            continue;
+        }
+
+        const float spikeTime = *(spike - 1);
+        if (spikeTime >= start)
+        {
+            data[cell] = 0.f;
+            continue;
+        }
+
+        // decay from the last frame which had the spike in its window
+        const auto spikeFrame = static_cast<uint32_t>(spikeTime / dt);
+        data[cell] = frame > spikeFrame ? float(frame - spikeFrame) : 0.f;
+    }
+
+    brayns::decayFrameValues(data, nbCells, values.spiking, values.rest,
+                             values.decaySpeed);
+}
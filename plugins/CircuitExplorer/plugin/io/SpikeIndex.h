@@ -0,0 +1,100 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of the circuit explorer for Brayns
+ * <https://github.com/favreau/Brayns-UC-CircuitExplorer>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef SPIKEINDEX_H
+#define SPIKEINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The SpikeIndex class stores all spikes of a report per cell, sorted by
+ * time, so the state of all cells at any time can be computed in
+ * O(cells * log(spikes per cell)) without replaying the report history.
+ *
+ * A cell is spiking if it has a spike in [start, end) of the requested time
+ * window. Otherwise its value decays linearly, frame by frame, from the
+ * spiking value to the rest value, starting at the frame of its last spike.
+ */
+class SpikeIndex
+{
+public:
+    struct Values
+    {
+        float rest;
+        float spiking;
+        float decaySpeed; // per frame
+    };
+
+    /**
+     * @param nbCells number of cells
+     * @param spikes spikes sorted by time
+     * @param cellIndex function returning the cell index of a spike, or
+     *        nbCells to ignore the spike
+     * @param spikeTime function returning the time of a spike
+     */
+    template <typename Spikes, typename CellIndexFunc, typename SpikeTimeFunc>
+    SpikeIndex(const size_t nbCells, const Spikes& spikes,
+               const CellIndexFunc& cellIndex, const SpikeTimeFunc& spikeTime)
+        : _offsets(nbCells + 1, 0)
+    {
+        // counting sort by cell keeps the time order within each cell
+        for (const auto& spike : spikes)
+        {
+            const auto cell = cellIndex(spike);
+            if (cell < nbCells)
+                ++_offsets[cell + 1];
+        }
+        for (size_t i = 0; i < nbCells; ++i)
+            _offsets[i + 1] += _offsets[i];
+
+        _times.resize(_offsets.back());
+        auto next = _offsets;
+        for (const auto& spike : spikes)
+        {
+            const auto cell = cellIndex(spike);
+            if (cell < nbCells)
+                _times[next[cell]++] = spikeTime(spike);
+        }
+    }
+
+    /**
+     * Compute the value of all cells for the given frame.
+     *
+     * @param start start of the spiking time window of the frame
+     * @param end end of the spiking time window of the frame
+     * @param frame the frame to compute
+     * @param dt the duration of a frame
+     * @param values the values for spiking, resting and decay
+     * @param data receives one value per cell
+     */
+    void computeFrame(float start, float end, uint32_t frame, float dt,
+                      const Values& values, float* data) const;
+
+    size_t getNbCells() const { return _offsets.size() - 1; }
+    size_t getNbSpikes() const { return _times.size(); }
+
+private:
+    std::vector<uint64_t> _offsets; // first spike of each cell in _times
+    std::vector<float> _times;
+};
+
+#endif // SPIKEINDEX_H
@@ -52,6 +52,18 @@ SpikeSimulationHandler::SpikeSimulationHandler(const std::string& reportPath,
     _frameSize = _gids.size();
     _frameData.resize(_frameSize, DEFAULT_REST_VALUE);
 
+    // Index all spikes by cell once, so that any frame can be computed
+    // directly instead of replaying the spikes of the previous frames
+    const auto& spikes =
+        _spikeReport->getSpikes(0.f, _spikeReport->getEndTime());
+    _spikeIndex = std::make_shared<SpikeIndex>(
+        _frameSize, spikes,
+        [this](const brain::Spike& spike) -> size_t {
+            const auto it = _gidMap.find(spike.second);
+            return it == _gidMap.end() ? _frameSize : it->second;
+        },
+        [](const brain::Spike& spike) { return spike.first; });
+
     PLUGIN_INFO << "-----------------------------------------------------------"
                 << std::endl;
     PLUGIN_INFO << "Spike simulation information" << std::endl;
@@ -65,6 +77,8 @@ SpikeSimulationHandler::SpikeSimulationHandler(const std::string& reportPath,
     PLUGIN_INFO << "Decay speed           : " << DEFAULT_DECAY_SPEED
                 << std::endl;
     PLUGIN_INFO << "Number of frames      : " << _nbFrames << std::endl;
+    PLUGIN_INFO << "Number of spikes      : " << _spikeIndex->getNbSpikes()
+                << std::endl;
     PLUGIN_INFO << "-----------------------------------------------------------"
                 << std::endl;
 }
@@ -76,6 +90,7 @@ SpikeSimulationHandler::SpikeSimulationHandler(
     , _gids(rhs._gids)
     , _spikeReport(rhs._spikeReport)
     , _gidMap(rhs._gidMap)
+    , _spikeIndex(rhs._spikeIndex)
 {
 }
 
@@ -84,23 +99,14 @@ void* SpikeSimulationHandler::getFrameData(const uint32_t frame)
     const auto boundedFrame = _getBoundedFrame(frame);
     if (_currentFrame != boundedFrame)
     {
-        for (size_t i = 0; i < _frameSize; ++i)
-        {
-            if (_frameData[i] > DEFAULT_REST_VALUE)
-                _frameData[i] -= DEFAULT_DECAY_SPEED;
-            else
-                _frameData[i] = DEFAULT_REST_VALUE;
-        }
-
         const float ts = boundedFrame * _dt;
         const float endTime = _spikeReport->getEndTime() - _dt;
-        const auto& spikes =
-            _spikeReport->getSpikes(std::min(ts, endTime),
-                                    std::min(ts + 1.f, endTime));
-
-        for (const auto spike : spikes)
-            _frameData[_gidMap[spike.second]] = DEFAULT_SPIKING_VALUE;
-
+        _spikeIndex->computeFrame(std::min(ts, endTime),
+                                  std::min(ts + 1.f, endTime), boundedFrame,
+                                  _dt, {DEFAULT_REST_VALUE,
+                                        DEFAULT_SPIKING_VALUE,
+                                        DEFAULT_DECAY_SPEED},
+                                  _frameData.data());
         _currentFrame = boundedFrame;
     }
 
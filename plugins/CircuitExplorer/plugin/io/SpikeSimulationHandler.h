@@ -22,6 +22,8 @@
 #ifndef SPIKESIMULATIONHANDLER_H
 #define SPIKESIMULATIONHANDLER_H
 
+#include "SpikeIndex.h"
+
 #include <brain/brain.h>
 #include <brayns/api.h>
 #include <brayns/common/simulation/AbstractSimulationHandler.h>
@@ -29,6 +31,7 @@
 #include <brayns/engineapi/Scene.h>
 
 typedef std::shared_ptr<brain::SpikeReportReader> SpikeReportReaderPtr;
+typedef std::shared_ptr<const SpikeIndex> SpikeIndexPtr;
 
 class SpikeSimulationHandler : public brayns::AbstractSimulationHandler
 {
@@ -50,6 +53,7 @@ private:
     SpikeReportReaderPtr _spikeReport;
 
     std::map<uint64_t, uint64_t> _gidMap;
+    SpikeIndexPtr _spikeIndex;
 };
 
 #endif // SPIKESIMULATIONHANDLER_H
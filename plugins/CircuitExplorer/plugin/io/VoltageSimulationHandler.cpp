@@ -29,7 +29,8 @@
 
 VoltageSimulationHandler::VoltageSimulationHandler(
     const std::string& reportPath, const brion::GIDSet& gids,
-    const bool synchronousMode)
+    const bool synchronousMode, const std::string& frameCacheFolder,
+    const uint64_t frameCacheSize)
     : brayns::AbstractSimulationHandler()
     , _synchronousMode(synchronousMode)
     , _reportPath(reportPath)
@@ -52,6 +53,33 @@ VoltageSimulationHandler::VoltageSimulationHandler(
     PLUGIN_INFO << "Frame size           : " << _frameSize << std::endl;
     PLUGIN_INFO << "-----------------------------------------------------------"
                 << std::endl;
+
+    if (!frameCacheFolder.empty())
+    {
+        _frameCache =
+            std::make_shared<brayns::FrameCache>(frameCacheFolder, _frameSize,
+                                                 _nbFrames, frameCacheSize);
+        PLUGIN_INFO << "Caching up to " << _frameCache->getCapacity()
+                    << " frames in " << frameCacheFolder << std::endl;
+    }
+
+    if (!_synchronousMode)
+        _setFrameLoader([report = _compartmentReport, dt = _dt,
+                         nbFrames = _nbFrames,
+                         cache = _frameCache](const uint32_t frame) {
+            brayns::floats data;
+            if (cache && cache->read(frame, data))
+                return data;
+
+            const float timestamp =
+                std::min(static_cast<float>(nbFrames), float(frame * dt));
+            auto frameData = report->loadFrame(timestamp).get().data;
+            if (frameData)
+                data = std::move(*frameData);
+            if (cache)
+                cache->write(frame, data);
+            return data;
+        });
 }
 
 VoltageSimulationHandler::VoltageSimulationHandler(
@@ -75,17 +103,60 @@ bool VoltageSimulationHandler::isReady() const
     return _ready;
 }
 
+void VoltageSimulationHandler::waitReady() const
+{
+    if (_isPrefetching())
+    {
+        if (!_ready)
+            _waitPrefetchedFrame(_requestedFrame);
+        return;
+    }
+
+    if (_currentFrameFuture.valid())
+        _currentFrameFuture.wait();
+}
+
 void* VoltageSimulationHandler::getFrameData(const uint32_t frame)
 {
     const auto boundedFrame = _getBoundedFrame(frame);
 
-    if (!_currentFrameFuture.valid() && _currentFrame != boundedFrame)
+    if (_isPrefetching())
+    {
+        _requestedFrame = boundedFrame;
+        _ready = _takePrefetchedFrame(boundedFrame);
+        // the previous frame is still in _frameData if not read ahead yet
+        return _ready ? _getFrameData() : nullptr;
+    }
+
+    if (!_currentFrameFuture.valid())
+    {
+        // e.g. clones, which have the data of the current frame already
+        if (_currentFrame == boundedFrame)
+        {
+            _ready = true;
+            return _getFrameData();
+        }
+        if (_frameCache && _frameCache->read(boundedFrame, _frameData))
+        {
+            _handedOverFrameData = nullptr;
+            _currentFrame = boundedFrame;
+            _ready = true;
+            return _frameData.data();
+        }
         _triggerLoading(boundedFrame);
+    }
 
     if (!_makeFrameReady(boundedFrame))
         return nullptr;
 
-    return _frameData.data();
+    // the previous frame if the requested one is still loading
+    return _getFrameData();
+}
+
+bool VoltageSimulationHandler::takeFrameData(const uint32_t frame,
+                                             brayns::floats& buffer)
+{
+    return _handOverFrameData(frame, buffer);
 }
 
 void VoltageSimulationHandler::_triggerLoading(const uint32_t frame)
@@ -97,6 +168,7 @@ void VoltageSimulationHandler::_triggerLoading(const uint32_t frame)
         _currentFrameFuture.wait();
 
     _ready = false;
+    _loadingFrame = frame;
     _currentFrameFuture = _compartmentReport->loadFrame(timestamp);
 }
 
@@ -122,6 +194,9 @@ bool VoltageSimulationHandler::_makeFrameReady(const uint32_t frame)
         try
         {
             _frameData = std::move(*_currentFrameFuture.get().data);
+            _handedOverFrameData = nullptr;
+            if (_frameCache)
+                _frameCache->write(_loadingFrame, _frameData);
         }
         catch (const std::exception& e)
         {
@@ -129,7 +204,7 @@ bool VoltageSimulationHandler::_makeFrameReady(const uint32_t frame)
                          << e.what() << std::endl;
             return false;
         }
-        _currentFrame = frame;
+        _currentFrame = _loadingFrame;
         _ready = true;
     }
     return true;
@@ -26,6 +26,7 @@
 #include <plugin/api/CircuitExplorerParams.h>
 
 #include <brayns/api.h>
+#include <brayns/common/simulation/FrameCache.h>
 #include <brayns/common/types.h>
 #include <brayns/engineapi/Scene.h>
 #include <brion/brion.h>
@@ -46,19 +47,26 @@ public:
      * @param geometryParameters Geometry parameters
      * @param reportSource path to report source
      * @param gids GIDS to load
+     * @param frameCacheFolder local folder to cache frames in, no cache if
+     *        empty
+     * @param frameCacheSize maximum size of the frame cache in bytes
      */
     VoltageSimulationHandler(const std::string& reportPath,
                              const brion::GIDSet& gids,
-                             const bool synchronousMode = false);
+                             const bool synchronousMode = false,
+                             const std::string& frameCacheFolder = {},
+                             const uint64_t frameCacheSize = 0);
     VoltageSimulationHandler(const VoltageSimulationHandler& rhs);
     ~VoltageSimulationHandler();
 
     void* getFrameData(const uint32_t frame) final;
+    bool takeFrameData(const uint32_t frame, brayns::floats& buffer) final;
 
     const std::string& getReportPath() const { return _reportPath; }
     CompartmentReportPtr getReport() const { return _compartmentReport; }
     bool isSynchronized() const { return _synchronousMode; }
     bool isReady() const final;
+    void waitReady() const final;
 
     brayns::AbstractSimulationHandlerPtr clone() const final;
 
@@ -71,6 +79,8 @@ private:
     std::string _reportPath;
     CompartmentReportPtr _compartmentReport;
     std::future<brion::Frame> _currentFrameFuture;
+    uint32_t _loadingFrame{0};
+    uint32_t _requestedFrame{0};
     std::map<uint64_t, std::vector<float>> _frames;
     bool _ready{false};
 };
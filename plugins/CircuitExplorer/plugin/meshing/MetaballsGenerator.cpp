@@ -28,8 +28,27 @@
 #include <brayns/common/log.h>
 #include <brayns/engineapi/Material.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 const size_t NB_EDGES = 12;
 
+// The field of a metaball fades out to zero where it would fall below this
+// fraction of the threshold, so that it only affects the grid vertices around
+// it. The sum of the unbounded fields would not converge with many metaballs.
+const float MIN_FIELD_CONTRIBUTION = 0.01f;
+
+// Number of slabs of the grid which are meshed by one thread at a time
+const size_t SLABS_PER_BLOCK = 16;
+
+const uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+// Grid offsets in x, y and z of the cube corners
+const size_t METABALLS_CORNERS[8][3] = {{0, 0, 0}, {0, 0, 1}, {0, 1, 1},
+                                        {0, 1, 0}, {1, 0, 0}, {1, 0, 1},
+                                        {1, 1, 1}, {1, 1, 0}};
+
 const size_t METABALLS_VERTICES[24] = {0, 1, 1, 2, 2, 3, 3, 0, 4, 5, 5, 6,
                                        6, 7, 7, 4, 0, 4, 1, 5, 2, 6, 3, 7};
 
@@ -235,7 +254,7 @@ const int8_t METABALLS_TRIANGLES[256][16] = {
     {9, 5, 4, 10, 1, 6, 1, 7, 6, 1, 3, 7, -1, -1, -1, -1},
     {1, 6, 10, 1, 7, 6, 1, 0, 7, 8, 7, 0, 9, 5, 4, -1},
     {4, 0, 10, 4, 10, 5, 0, 3, 10, 6, 10, 7, 3, 7, 10, -1},
-    {7, 6, 10, 7, 10, 58, 5, 4, 10, 4, 8, 10, -1, -1, -1, -1},
+    {7, 6, 10, 7, 10, 8, 5, 4, 10, 4, 8, 10, -1, -1, -1, -1},
     {6, 9, 5, 6, 11, 9, 11, 8, 9, -1, -1, -1, -1, -1, -1, -1},
     {3, 6, 11, 0, 6, 3, 0, 5, 6, 0, 9, 5, -1, -1, -1, -1},
     {0, 11, 8, 0, 5, 11, 0, 1, 5, 5, 6, 11, -1, -1, -1, -1},
@@ -322,14 +341,18 @@ MetaballsGenerator::~MetaballsGenerator()
     _clear();
 }
 
-void MetaballsGenerator::_buildVerticesAndCubes(
-    const brayns::Vector4fs& metaballs, const size_t gridSize,
-    const size_t defaultMaterialId, const float scale)
+void MetaballsGenerator::_buildGrid(const brayns::Vector4fs& metaballs,
+                                    const size_t gridSize,
+                                    const float threshold, const float scale)
 {
-    // Determine bounding box
+    // Determine bounding box, which is not empty for a single metaball
     brayns::Box<float> bounds;
     for (const auto& ball : metaballs)
-        bounds.merge(brayns::Vector3f(ball.x, ball.y, ball.z));
+    {
+        const brayns::Vector3f center(ball.x, ball.y, ball.z);
+        bounds.merge(center - ball.w);
+        bounds.merge(center + ball.w);
+    }
     const auto center = bounds.getCenter();
 
     // Upscale the bounding box to make sure there is no whole in the isosurface
@@ -337,235 +360,341 @@ void MetaballsGenerator::_buildVerticesAndCubes(
         brayns::Box<float>(center - bounds.getSize() * scale / 2.f,
                            center + bounds.getSize() * scale / 2.f);
 
-    const auto rescaledSize = rescaledBounds.getSize();
-    const size_t incrementedSize = gridSize + 1;
-    _vertices.resize(incrementedSize * incrementedSize * incrementedSize);
+    _gridSize = gridSize;
+    _origin = rescaledBounds.getMin();
+    _cellSize = rescaledBounds.getSize() / float(gridSize);
 
-    size_t x = 0;
-    for (x = 0; x < incrementedSize; ++x)
-    {
-        for (size_t y = 0; y < incrementedSize; ++y)
+    const int64_t nbVertices = gridSize + 1;
+    const auto toRange = [nbVertices](const float center, const float radius,
+                                      const float origin, const float size,
+                                      int64_t& minIndex, int64_t& maxIndex) {
+        if (size == 0.f)
         {
-            for (size_t z = 0; z < incrementedSize; ++z)
-            {
-                CubeGridVertex cgv;
-                cgv.position.x =
-                    rescaledBounds.getMin().x + x * rescaledSize.x / gridSize;
-                cgv.position.y =
-                    rescaledBounds.getMin().y + y * rescaledSize.y / gridSize;
-                cgv.position.z =
-                    rescaledBounds.getMin().z + z * rescaledSize.z / gridSize;
-
-                cgv.texCoords.x =
-                    static_cast<float>(x) / static_cast<float>(gridSize);
-                cgv.texCoords.y =
-                    static_cast<float>(y) / static_cast<float>(gridSize);
-                cgv.texCoords.z = 0.f;
-
-                cgv.value = 0.f;
-                cgv.normal = {0.f, 0.f, 0.f};
-
-                cgv.materialId = defaultMaterialId;
-
-                const size_t index = x * incrementedSize * incrementedSize +
-                                     y * incrementedSize + z;
-
-                _vertices[index] = cgv;
-            }
+            minIndex = 0;
+            maxIndex = nbVertices - 1;
+            return;
         }
-    }
-
-    _cubes.resize(gridSize * gridSize * gridSize);
-    for (x = 0; x < gridSize; ++x)
+        // clamp before the conversion for unbounded influence radii
+        const float maxIndexValue = nbVertices - 1;
+        minIndex = std::max(0.f, std::ceil((center - radius - origin) / size));
+        maxIndex = std::min(maxIndexValue,
+                            std::floor((center + radius - origin) / size));
+    };
+
+    _influences.resize(nbVertices);
+    _squaredInfluenceRadii.resize(metaballs.size());
+    for (size_t i = 0; i < metaballs.size(); ++i)
     {
-        for (size_t y = 0; y < gridSize; ++y)
-        {
-            for (size_t z = 0; z < gridSize; ++z)
-            {
-                CubeGridCube cgc;
-                cgc.vertices[0] =
-                    &_vertices[(x * incrementedSize + y) * incrementedSize + z];
-                cgc.vertices[1] =
-                    &_vertices[(x * incrementedSize + y) * incrementedSize + z +
-                               1];
-                cgc.vertices[2] = &_vertices[(x * incrementedSize + (y + 1)) *
-                                                 incrementedSize +
-                                             z + 1];
-                cgc.vertices[3] = &_vertices[(x * incrementedSize + (y + 1)) *
-                                                 incrementedSize +
-                                             z];
-                cgc.vertices[4] = &_vertices[((x + 1) * incrementedSize + y) *
-                                                 incrementedSize +
-                                             z];
-                cgc.vertices[5] = &_vertices[((x + 1) * incrementedSize + y) *
-                                                 incrementedSize +
-                                             z + 1];
-                cgc.vertices[6] =
-                    &_vertices[((x + 1) * incrementedSize + (y + 1)) *
-                                   incrementedSize +
-                               z + 1];
-                cgc.vertices[7] =
-                    &_vertices[((x + 1) * incrementedSize + (y + 1)) *
-                                   incrementedSize +
-                               z];
-
-                const size_t index = x * gridSize * gridSize + y * gridSize + z;
-                _cubes[index] = cgc;
-            }
-        }
+        const auto& metaball = metaballs[i];
+        const float influenceRadius =
+            metaball.w / std::sqrt(MIN_FIELD_CONTRIBUTION * threshold);
+        _squaredInfluenceRadii[i] = influenceRadius * influenceRadius;
+
+        Influence influence{i, 0, 0, 0, 0};
+        int64_t minX, maxX;
+        toRange(metaball.x, influenceRadius, _origin.x, _cellSize.x, minX,
+                maxX);
+        toRange(metaball.y, influenceRadius, _origin.y, _cellSize.y,
+                influence.minY, influence.maxY);
+        toRange(metaball.z, influenceRadius, _origin.z, _cellSize.z,
+                influence.minZ, influence.maxZ);
+        if (influence.minY > influence.maxY || influence.minZ > influence.maxZ)
+            continue;
+        for (int64_t x = minX; x <= maxX; ++x)
+            _influences[x].push_back(influence);
     }
 
     BRAYNS_DEBUG << "Nb metaballs   : " << metaballs.size() << std::endl;
-    BRAYNS_DEBUG << "Nb Vertices    : " << _vertices.size() << std::endl;
-    BRAYNS_DEBUG << "Nb Cubes       : " << _cubes.size() << std::endl;
     BRAYNS_DEBUG << "Grid size      : " << gridSize << std::endl;
     BRAYNS_DEBUG << "Grid dimensions: " << bounds << "/" << bounds.getSize()
                  << std::endl;
 }
 
-void MetaballsGenerator::_buildTriangles(const brayns::Vector4fs& metaballs,
-                                         const float threshold,
-                                         const size_t defaultMaterialId,
-                                         brayns::TriangleMeshMap& triangles)
+void MetaballsGenerator::_computeSlab(const brayns::Vector4fs& metaballs,
+                                      const size_t x, Slab& slab) const
 {
-    for (const auto metaball : metaballs)
+    const size_t nbVertices = _gridSize + 1;
+    slab.values.assign(nbVertices * nbVertices, 0.f);
+    slab.normals.assign(nbVertices * nbVertices, brayns::Vector3f(0.f));
+
+    const float positionX = _origin.x + x * _cellSize.x;
+    for (const auto& influence : _influences[x])
     {
-        const auto radius = metaball.w;
-        const auto squaredRadius = radius * radius;
+        const auto& metaball = metaballs[influence.metaball];
+        const brayns::Vector3f center(metaball);
+        const auto squaredRadius = metaball.w * metaball.w;
+        const auto squaredInfluenceRadius =
+            _squaredInfluenceRadii[influence.metaball];
 
-        for (auto& vertex : _vertices)
+        for (int64_t y = influence.minY; y <= influence.maxY; ++y)
         {
-            const auto ballToPoint =
-                vertex.position - brayns::Vector3f(metaball);
-
-            // get squared distance from ball to point
-            const auto distance = ballToPoint.length();
-            auto squaredDistance = distance * distance;
-
-            if (squaredDistance == 0.f)
-                continue;
-
-            const auto normalScale = squaredRadius / squaredDistance;
-            vertex.value += normalScale;
-
-            if (distance < threshold)
-                vertex.materialId = defaultMaterialId;
+            const size_t row = y * nbVertices;
+            for (int64_t z = influence.minZ; z <= influence.maxZ; ++z)
+            {
+                const brayns::Vector3f position(positionX,
+                                                _origin.y + y * _cellSize.y,
+                                                _origin.z + z * _cellSize.z);
+                const auto ballToPoint = position - center;
+                const auto squaredDistance = glm::dot(ballToPoint, ballToPoint);
+                if (squaredDistance > squaredInfluenceRadius)
+                    continue;
 
-            vertex.normal += ballToPoint * normalScale;
+                // The field is unbounded at the center of the metaball
+                if (squaredDistance == 0.f)
+                {
+                    slab.values[row + z] = std::numeric_limits<float>::max();
+                    continue;
+                }
+
+                const auto falloff =
+                    1.f - squaredDistance / squaredInfluenceRadius;
+                const auto normalScale =
+                    squaredRadius / squaredDistance * falloff * falloff;
+                slab.values[row + z] += normalScale;
+                slab.normals[row + z] += ballToPoint * normalScale;
+            }
         }
     }
 
-    for (const auto& cube : _cubes)
+    slab.rowMin.resize(nbVertices);
+    slab.rowMax.resize(nbVertices);
+    for (size_t y = 0; y < nbVertices; ++y)
+    {
+        const auto row = slab.values.begin() + y * nbVertices;
+        const auto range = std::minmax_element(row, row + nbVertices);
+        slab.rowMin[y] = *range.first;
+        slab.rowMax[y] = *range.second;
+    }
+}
+
+void MetaballsGenerator::_polygonizeSlabs(const size_t x, const Slab& slab,
+                                          const Slab& nextSlab,
+                                          const float threshold,
+                                          EdgeVertices& edgeVertices,
+                                          brayns::TriangleMesh& mesh) const
+{
+    const size_t nbVertices = _gridSize + 1;
+    const Slab* slabs[2] = {&slab, &nextSlab};
+
+    for (size_t y = 0; y < _gridSize; ++y)
     {
-        unsigned char cubeIndex = 0;
-
-        if (cube.vertices[0]->value > 0.f &&
-            cube.vertices[0]->value < threshold)
-            cubeIndex |= 1;
-        if (cube.vertices[1]->value > 0.f &&
-            cube.vertices[1]->value < threshold)
-            cubeIndex |= 2;
-        if (cube.vertices[2]->value > 0.f &&
-            cube.vertices[2]->value < threshold)
-            cubeIndex |= 4;
-        if (cube.vertices[3]->value > 0.f &&
-            cube.vertices[3]->value < threshold)
-            cubeIndex |= 8;
-        if (cube.vertices[4]->value > 0.f &&
-            cube.vertices[4]->value < threshold)
-            cubeIndex |= 16;
-        if (cube.vertices[5]->value > 0.f &&
-            cube.vertices[5]->value < threshold)
-            cubeIndex |= 32;
-        if (cube.vertices[6]->value > 0.f &&
-            cube.vertices[6]->value < threshold)
-            cubeIndex |= 64;
-        if (cube.vertices[7]->value > 0.f &&
-            cube.vertices[7]->value < threshold)
-            cubeIndex |= 128;
-
-        int usedEdges = METABALLS_EDGES[cubeIndex];
-
-        if (usedEdges == 0 || usedEdges == 255)
+        // skip rows of cubes which are entirely inside or outside
+        const float minValue =
+            std::min(std::min(slab.rowMin[y], slab.rowMin[y + 1]),
+                     std::min(nextSlab.rowMin[y], nextSlab.rowMin[y + 1]));
+        const float maxValue =
+            std::max(std::max(slab.rowMax[y], slab.rowMax[y + 1]),
+                     std::max(nextSlab.rowMax[y], nextSlab.rowMax[y + 1]));
+        if (maxValue < threshold || minValue >= threshold)
             continue;
 
-        for (size_t currentEdge = 0; currentEdge < NB_EDGES; ++currentEdge)
+        for (size_t z = 0; z < _gridSize; ++z)
         {
-            // Check usedEdges against 1,2,4,8,16,...,2048
-            if (usedEdges & (1 << currentEdge))
+            float values[8];
+            size_t cubeIndex = 0;
+            for (size_t i = 0; i < 8; ++i)
             {
-                CubeGridVertex* v1 =
-                    cube.vertices[METABALLS_VERTICES[currentEdge * 2]];
-                CubeGridVertex* v2 =
-                    cube.vertices[METABALLS_VERTICES[currentEdge * 2 + 1]];
+                const auto corner = METABALLS_CORNERS[i];
+                values[i] = slabs[corner[0]]->values[(y + corner[1]) *
+                                                         nbVertices +
+                                                     z + corner[2]];
+                if (values[i] < threshold)
+                    cubeIndex |= 1 << i;
+            }
 
-                const float denom = (v2->value - v1->value);
-                if (fabs(denom) < 0.00001f)
-                    continue;
+            const size_t usedEdges = METABALLS_EDGES[cubeIndex];
+            if (usedEdges == 0)
+                continue;
 
-                auto delta = (threshold - v1->value) / denom;
+            uint32_t vertexIndices[NB_EDGES];
+            for (size_t currentEdge = 0; currentEdge < NB_EDGES; ++currentEdge)
+            {
+                // Check usedEdges against 1,2,4,8,16,...,2048
+                if (!(usedEdges & (1 << currentEdge)))
+                    continue;
 
-                brayns::Vector3f position;
-                position.x =
-                    v1->position.x + delta * (v2->position.x - v1->position.x);
-                position.y =
-                    v1->position.y + delta * (v2->position.y - v1->position.y);
-                position.z =
-                    v1->position.z + delta * (v2->position.z - v1->position.z);
+                const auto v1 = METABALLS_VERTICES[currentEdge * 2];
+                const auto v2 = METABALLS_VERTICES[currentEdge * 2 + 1];
+                const auto c1 = METABALLS_CORNERS[v1];
+                const auto c2 = METABALLS_CORNERS[v2];
+
+                // Vertices are shared by all cubes around the grid edge
+                const size_t slabIndex = std::min(c1[0], c2[0]);
+                const size_t edge =
+                    (y + std::min(c1[1], c2[1])) * nbVertices + z +
+                    std::min(c1[2], c2[2]);
+                uint32_t& vertexIndex =
+                    c1[0] != c2[0]
+                        ? edgeVertices.x[edge]
+                        : (c1[1] != c2[1] ? edgeVertices.y[slabIndex][edge]
+                                          : edgeVertices.z[slabIndex][edge]);
+                if (vertexIndex != NO_VERTEX)
+                {
+                    vertexIndices[currentEdge] = vertexIndex;
+                    continue;
+                }
+
+                const float denom = values[v2] - values[v1];
+                const float delta = std::fabs(denom) < 0.00001f
+                                        ? 0.5f
+                                        : (threshold - values[v1]) / denom;
+
+                const brayns::Vector3f p1(_origin.x + (x + c1[0]) * _cellSize.x,
+                                          _origin.y + (y + c1[1]) * _cellSize.y,
+                                          _origin.z +
+                                              (z + c1[2]) * _cellSize.z);
+                const brayns::Vector3f p2(_origin.x + (x + c2[0]) * _cellSize.x,
+                                          _origin.y + (y + c2[1]) * _cellSize.y,
+                                          _origin.z +
+                                              (z + c2[2]) * _cellSize.z);
+                const auto& n1 =
+                    slabs[c1[0]]->normals[(y + c1[1]) * nbVertices + z + c1[2]];
+                const auto& n2 =
+                    slabs[c2[0]]->normals[(y + c2[1]) * nbVertices + z + c2[2]];
+
+                const auto normal = n1 + delta * (n2 - n1);
+                const auto length = glm::length(normal);
+
+                vertexIndex = mesh.vertices.size();
+                mesh.vertices.push_back(p1 + delta * (p2 - p1));
+                mesh.normals.push_back(length > 0.f ? normal / length
+                                                    : normal);
+                vertexIndices[currentEdge] = vertexIndex;
+            }
 
-                brayns::Vector3f normal;
-                normal.x = v1->normal.x + delta * (v2->normal.x - v1->normal.x);
-                normal.y = v1->normal.y + delta * (v2->normal.y - v1->normal.y);
-                normal.z = v1->normal.z + delta * (v2->normal.z - v1->normal.z);
+            for (auto k = 0; METABALLS_TRIANGLES[cubeIndex][k] != -1; k += 3)
+            {
+                // Create triangulated face
+                bool processFace = true;
+                for (auto f = 0; f < 3 && processFace; ++f)
+                {
+                    const size_t edge = METABALLS_TRIANGLES[cubeIndex][k + f];
+                    if (edge >= NB_EDGES || !(usedEdges & (1 << edge)))
+                        processFace = false;
+                }
+                if (!processFace)
+                    continue;
 
-                _edgeVertices[currentEdge].position = position;
-                _edgeVertices[currentEdge].normal = normal;
-                _edgeVertices[currentEdge].materialId = v1->materialId;
+                mesh.indices.push_back(brayns::Vector3ui(
+                    vertexIndices[METABALLS_TRIANGLES[cubeIndex][k]],
+                    vertexIndices[METABALLS_TRIANGLES[cubeIndex][k + 1]],
+                    vertexIndices[METABALLS_TRIANGLES[cubeIndex][k + 2]]));
             }
         }
+    }
+}
 
-        auto& vertices = triangles[defaultMaterialId].vertices;
-        auto& normals = triangles[defaultMaterialId].normals;
-        auto& indices = triangles[defaultMaterialId].indices;
-
-        for (auto k = 0; METABALLS_TRIANGLES[cubeIndex][k] != -1; k += 3)
+void MetaballsGenerator::_buildTriangles(const brayns::Vector4fs& metaballs,
+                                         const float threshold,
+                                         const size_t defaultMaterialId,
+                                         brayns::TriangleMeshMap& triangles)
+{
+    if (metaballs.empty())
+        return;
+
+    // Blocks of slabs are meshed in parallel. Each block only keeps two slabs
+    // of the grid, and computes the first one again from its predecessor.
+    const size_t nbBlocks = (_gridSize + SLABS_PER_BLOCK - 1) / SLABS_PER_BLOCK;
+    std::vector<brayns::TriangleMesh> meshes(nbBlocks);
+    std::vector<SlabVertices> firstSlabVertices(nbBlocks);
+    std::vector<SlabVertices> lastSlabVertices(nbBlocks);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t block = 0; block < int64_t(nbBlocks); ++block)
+    {
+        const size_t nbEdges = (_gridSize + 1) * (_gridSize + 1);
+        EdgeVertices edgeVertices;
+        for (size_t i = 0; i < 2; ++i)
         {
-            const auto verticesIndex = vertices.size();
-
-            // Create triangulated face
-            bool processFace = true;
-            for (auto f = 0; f < 3 && processFace; ++f)
-            {
-                const auto index = METABALLS_TRIANGLES[cubeIndex][k + f];
-                if (size_t(index) >= _edgeVertices.size())
-                    processFace = false;
-            }
-            if (!processFace)
-                continue;
+            edgeVertices.y[i].resize(nbEdges, NO_VERTEX);
+            edgeVertices.z[i].resize(nbEdges, NO_VERTEX);
+        }
+        edgeVertices.x.resize(nbEdges, NO_VERTEX);
 
-            for (auto f = 0; f < 3; ++f)
-            {
-                const auto index = METABALLS_TRIANGLES[cubeIndex][k + f];
+        const size_t begin = block * SLABS_PER_BLOCK;
+        const size_t end = std::min(begin + SLABS_PER_BLOCK, _gridSize);
 
-                const auto vertex = _edgeVertices[index].position;
-                vertices.push_back(vertex);
+        Slab slab;
+        Slab nextSlab;
+        _computeSlab(metaballs, begin, slab);
+        for (size_t x = begin; x < end; ++x)
+        {
+            _computeSlab(metaballs, x + 1, nextSlab);
+            _polygonizeSlabs(x, slab, nextSlab, threshold, edgeVertices,
+                             meshes[block]);
+            if (x == begin)
+                _getSlabVertices(edgeVertices, firstSlabVertices[block]);
+
+            std::swap(slab, nextSlab);
+            std::swap(edgeVertices.y[0], edgeVertices.y[1]);
+            std::swap(edgeVertices.z[0], edgeVertices.z[1]);
+            std::fill(edgeVertices.y[1].begin(), edgeVertices.y[1].end(),
+                      NO_VERTEX);
+            std::fill(edgeVertices.z[1].begin(), edgeVertices.z[1].end(),
+                      NO_VERTEX);
+            std::fill(edgeVertices.x.begin(), edgeVertices.x.end(), NO_VERTEX);
+        }
+        _getSlabVertices(edgeVertices, lastSlabVertices[block]);
+    }
 
-                const auto normal = normalize(_edgeVertices[index].normal);
-                normals.push_back(normal);
+    // The first slab of a block is the last one of the previous block, whose
+    // vertices are used instead of the identical ones of the block
+    auto& mesh = triangles[defaultMaterialId];
+    for (size_t block = 0; block < nbBlocks; ++block)
+    {
+        auto& blockMesh = meshes[block];
+        std::vector<uint32_t> vertexIndices(blockMesh.vertices.size(),
+                                            NO_VERTEX);
+        if (block > 0)
+        {
+            const auto& sharedVertices = lastSlabVertices[block - 1];
+            auto shared = sharedVertices.begin();
+            for (const auto& vertex : firstSlabVertices[block])
+            {
+                while (shared != sharedVertices.end() &&
+                       shared->first < vertex.first)
+                    ++shared;
+                if (shared != sharedVertices.end() &&
+                    shared->first == vertex.first)
+                    vertexIndices[vertex.second] = shared->second;
             }
+        }
 
-            indices.push_back(brayns::Vector3ui(verticesIndex,
-                                                verticesIndex + 1,
-                                                verticesIndex + 2));
+        for (size_t i = 0; i < vertexIndices.size(); ++i)
+        {
+            if (vertexIndices[i] != NO_VERTEX)
+                continue;
+            vertexIndices[i] = mesh.vertices.size();
+            mesh.vertices.push_back(blockMesh.vertices[i]);
+            mesh.normals.push_back(blockMesh.normals[i]);
         }
+        for (const auto& indices : blockMesh.indices)
+            mesh.indices.push_back(brayns::Vector3ui(vertexIndices[indices.x],
+                                                     vertexIndices[indices.y],
+                                                     vertexIndices[indices.z]));
+        for (auto& vertex : lastSlabVertices[block])
+            vertex.second = vertexIndices[vertex.second];
+        blockMesh = brayns::TriangleMesh();
+    }
+}
+
+void MetaballsGenerator::_getSlabVertices(const EdgeVertices& edgeVertices,
+                                          SlabVertices& vertices)
+{
+    vertices.clear();
+    for (size_t edge = 0; edge < edgeVertices.y[0].size(); ++edge)
+    {
+        if (edgeVertices.y[0][edge] != NO_VERTEX)
+            vertices.emplace_back(2 * edge, edgeVertices.y[0][edge]);
+        if (edgeVertices.z[0][edge] != NO_VERTEX)
+            vertices.emplace_back(2 * edge + 1, edgeVertices.z[0][edge]);
     }
 }
 
 void MetaballsGenerator::_clear()
 {
-    _edgeVertices.resize(NB_EDGES);
-    _vertices.clear();
-    _cubes.clear();
+    _influences.clear();
+    _squaredInfluenceRadii.clear();
 }
 
 void MetaballsGenerator::generateMesh(const brayns::Vector4fs& metaballs,
@@ -575,6 +704,6 @@ void MetaballsGenerator::generateMesh(const brayns::Vector4fs& metaballs,
                                       brayns::TriangleMeshMap& triangles)
 {
     _clear();
-    _buildVerticesAndCubes(metaballs, gridSize, defaultMaterialId);
+    _buildGrid(metaballs, gridSize, threshold);
     _buildTriangles(metaballs, threshold, defaultMaterialId, triangles);
 }
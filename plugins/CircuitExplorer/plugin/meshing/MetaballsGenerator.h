@@ -24,6 +24,7 @@
 #ifndef METABALLSGENERATOR_H
 #define METABALLSGENERATOR_H
 
+#include <brayns/common/geometry/TriangleMesh.h>
 #include <brayns/common/types.h>
 
 /**
@@ -51,52 +52,64 @@ public:
                       brayns::TriangleMeshMap& triangles);
 
 private:
-    struct SurfaceVertex
+    // Range of grid vertices within the influence radius of a metaball, for
+    // one x slab of the grid
+    struct Influence
     {
-        SurfaceVertex()
-            : materialId(0)
-        {
-        }
-
-        brayns::Vector3f position;
-        brayns::Vector3f normal;
-        brayns::Vector3f texCoords;
-        size_t materialId;
+        size_t metaball;
+        int64_t minY, maxY, minZ, maxZ;
     };
 
-    struct CubeGridVertex : public SurfaceVertex
+    // Field values and normals of one x slab of grid vertices, with the value
+    // range of each row along z to skip empty blocks
+    struct Slab
     {
-        CubeGridVertex()
-            : SurfaceVertex()
-            , value(0)
-        {
-        }
-
-        float value; // Value of the scalar field
+        brayns::floats values;
+        brayns::Vector3fs normals;
+        brayns::floats rowMin;
+        brayns::floats rowMax;
     };
 
-    struct CubeGridCube
+    // Mesh vertex indices of the grid edges crossing the surface, for the
+    // edges along y and z of two slabs and the edges along x between them
+    struct EdgeVertices
     {
-        CubeGridVertex* vertices[8];
+        std::vector<uint32_t> y[2];
+        std::vector<uint32_t> z[2];
+        std::vector<uint32_t> x;
     };
 
-    typedef std::vector<CubeGridVertex> Vertices;
-    typedef std::vector<CubeGridCube> Cubes;
-    typedef std::vector<SurfaceVertex> SurfaceVertices;
+    // Mesh vertex indices of the grid edges along y and z of a slab crossing
+    // the surface, ordered by edge
+    using SlabVertices = std::vector<std::pair<size_t, uint32_t>>;
 
     void _clear();
 
-    void _buildVerticesAndCubes(const brayns::Vector4fs& metaballs,
-                                const size_t gridSize,
-                                const size_t defaultMaterialId,
-                                const float scale = 5.f);
+    void _buildGrid(const brayns::Vector4fs& metaballs, const size_t gridSize,
+                    const float threshold, const float scale = 5.f);
+
+    /** Accumulate the field of the metaballs at the vertices of a slab. */
+    void _computeSlab(const brayns::Vector4fs& metaballs, const size_t x,
+                      Slab& slab) const;
+
+    /** Polygonize the cubes between the slabs x and x + 1. */
+    void _polygonizeSlabs(const size_t x, const Slab& slab,
+                          const Slab& nextSlab, const float threshold,
+                          EdgeVertices& edgeVertices,
+                          brayns::TriangleMesh& mesh) const;
+
+    /** Collect the vertices of the first slab of edgeVertices. */
+    static void _getSlabVertices(const EdgeVertices& edgeVertices,
+                                 SlabVertices& vertices);
 
     void _buildTriangles(const brayns::Vector4fs& metaballs,
                          const float threshold, const size_t defaultMaterialId,
                          brayns::TriangleMeshMap& triangles);
 
-    SurfaceVertices _edgeVertices;
-    Vertices _vertices;
-    Cubes _cubes;
+    size_t _gridSize{0};
+    brayns::Vector3f _origin;
+    brayns::Vector3f _cellSize;
+    std::vector<std::vector<Influence>> _influences; // per x slab
+    brayns::floats _squaredInfluenceRadii;           // per metaball
 };
 #endif // METABALLSGENERATOR_H
@@ -27,63 +27,91 @@
 
 #if (CIRCUITEXPLORER_USE_CGAL)
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
-#include <CGAL/Random.h>
-#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/Polyhedron_3.h>
 #include <CGAL/convex_hull_3.h>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
 typedef CGAL::Polyhedron_3<K> Polyhedron_3;
 typedef K::Point_3 Point_3;
-typedef K::Segment_3 Segment_3;
-typedef K::Triangle_3 Triangle_3;
 #endif
 
 PointCloudMesher::PointCloudMesher() {}
 
 #if (CIRCUITEXPLORER_USE_CGAL)
-bool PointCloudMesher::toConvexHull(brayns::Model& model,
-                                    const PointCloud& pointCloud)
+ConvexHulls PointCloudMesher::computeConvexHulls(
+    const PointCloud& pointCloud) const
 {
-    bool addModel{false};
-    for (const auto& point : pointCloud)
-    {
-        model.createMaterial(point.first, std::to_string(point.first));
+    std::vector<PointCloud::const_iterator> clouds;
+    for (auto it = pointCloud.begin(); it != pointCloud.end(); ++it)
+        clouds.push_back(it);
 
-        std::vector<Point_3> points;
-        for (const auto& c : point.second)
-            points.push_back({c.x(), c.y(), c.z()});
+    // All CGAL objects are local to the thread computing a hull
+    std::vector<brayns::Cylinders> hulls(clouds.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < int64_t(clouds.size()); ++i)
+    {
+        const auto& points = clouds[i]->second;
+        std::vector<Point_3> cgalPoints;
+        cgalPoints.reserve(points.size());
+        for (const auto& c : points)
+            cgalPoints.push_back({c.x, c.y, c.z});
 
         CGAL::Object obj;
         // compute convex hull of non-collinear points
-        CGAL::convex_hull_3(points.begin(), points.end(), obj);
-        if (const Polyhedron_3* poly = CGAL::object_cast<Polyhedron_3>(&obj))
+        CGAL::convex_hull_3(cgalPoints.begin(), cgalPoints.end(), obj);
+        const Polyhedron_3* poly = CGAL::object_cast<Polyhedron_3>(&obj);
+        if (!poly)
+            continue;
+
+        auto& hull = hulls[i];
+        hull.reserve(poly->size_of_halfedges() / 2);
+        for (auto eit = poly->edges_begin(); eit != poly->edges_end(); ++eit)
         {
-            PLUGIN_INFO << "The convex hull contains "
-                        << poly->size_of_vertices() << " vertices" << std::endl;
-
-            for (auto eit = poly->edges_begin(); eit != poly->edges_end();
-                 ++eit)
-            {
-                Point_3 a = eit->vertex()->point();
-                Point_3 b = eit->opposite()->vertex()->point();
-                const brayns::Cylinder cylinder(Vec3(a.x(), a.y(), a.z()),
-                                                Vec3(b.x(), b.y(), b.z()), 1.f);
-                model.addCylinder(point.first, cylinder);
-                addModel = true;
-            }
+            const Point_3& a = eit->vertex()->point();
+            const Point_3& b = eit->opposite()->vertex()->point();
+            hull.emplace_back(brayns::Vector3f(a.x(), a.y(), a.z()),
+                              brayns::Vector3f(b.x(), b.y(), b.z()), 1.f);
         }
-        else
-            PLUGIN_ERROR << "something else" << std::endl;
     }
-    return addModel;
+
+    ConvexHulls convexHulls;
+    for (size_t i = 0; i < clouds.size(); ++i)
+        if (!hulls[i].empty())
+            convexHulls[clouds[i]->first] = std::move(hulls[i]);
+    return convexHulls;
 }
 #else
-bool PointCloudMesher::toConvexHull(brayns::Model&, const PointCloud&)
+ConvexHulls PointCloudMesher::computeConvexHulls(const PointCloud&) const
 {
-    return false;
+    return {};
 }
 #endif
 
+bool PointCloudMesher::toConvexHull(brayns::Model& model,
+                                    const PointCloud& pointCloud)
+{
+    const auto convexHulls = computeConvexHulls(pointCloud);
+    for (const auto& point : pointCloud)
+    {
+        model.createMaterial(point.first, std::to_string(point.first));
+
+        const auto hull = convexHulls.find(point.first);
+        if (hull == convexHulls.end())
+        {
+            PLUGIN_ERROR << "No convex hull for material " << point.first
+                         << std::endl;
+            continue;
+        }
+
+        PLUGIN_INFO << "The convex hull of material " << point.first
+                    << " contains " << hull->second.size() << " edges"
+                    << std::endl;
+        for (const auto& cylinder : hull->second)
+            model.addCylinder(point.first, cylinder);
+    }
+    return !convexHulls.empty();
+}
+
 #if (CIRCUITEXPLORER_USE_CGAL)
 bool PointCloudMesher::toMetaballs(brayns::Model& model,
                                    const PointCloud& pointCloud,
@@ -101,7 +129,7 @@ bool PointCloudMesher::toMetaballs(brayns::Model& model,
 
         model.createMaterial(point.first, std::to_string(point.first));
 
-        brayns::MetaballsGenerator metaballsGenerator;
+        MetaballsGenerator metaballsGenerator;
         metaballsGenerator.generateMesh(point.second, gridSize, threshold,
                                         point.first, triangles);
     }
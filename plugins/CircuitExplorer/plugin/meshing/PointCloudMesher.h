@@ -22,11 +22,15 @@
 #ifndef POINTCLOUDMESHER_H
 #define POINTCLOUDMESHER_H
 
+#include <brayns/common/geometry/Cylinder.h>
 #include <brayns/common/types.h>
 #include <map>
 
 typedef std::map<size_t, std::vector<brayns::Vector4f>> PointCloud;
 
+// Edges of the convex hull of each point cloud, per material
+typedef std::map<size_t, brayns::Cylinders> ConvexHulls;
+
 class PointCloudMesher
 {
 public:
@@ -34,6 +38,12 @@ public:
 
     bool toConvexHull(brayns::Model& model, const PointCloud& pointCloud);
 
+    /**
+     * Compute the convex hulls of all point clouds in parallel. Point clouds
+     * which do not span a volume have no hull.
+     */
+    ConvexHulls computeConvexHulls(const PointCloud& pointCloud) const;
+
     bool toMetaballs(brayns::Model& model, const PointCloud& pointCloud,
                      const size_t gridSize, const float threshold);
 };
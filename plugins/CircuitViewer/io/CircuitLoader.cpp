@@ -56,6 +56,13 @@ const Property PROP_TARGETS = {
     {"Targets", "Circuit targets [comma separated list of int, int-int or label]"}};
 const Property PROP_SYNCHRONOUS_MODE = {
     "synchronousMode", false, {"Synchronous mode"}};
+const Property PROP_FRAME_CACHE_FOLDER = {
+    "frameCacheFolder", std::string(),
+    {"Frame cache folder",
+     "Local folder to cache simulation frames in, disabled if empty [string]"}};
+const Property PROP_FRAME_CACHE_SIZE = {
+    "frameCacheSize", 1024,
+    {"Frame cache size", "Maximum size of the frame cache in MB [int]"}};
 // clang-format on
 
 constexpr auto LOADER_NAME = "circuit";
@@ -276,6 +283,8 @@ struct CircuitProperties
         setVariable(report, PROP_REPORT.name, "");
         setVariable(targets, PROP_TARGETS.name, "");
         setVariable(synchronousMode, PROP_SYNCHRONOUS_MODE.name, false);
+        setVariable(frameCacheFolder, PROP_FRAME_CACHE_FOLDER.name, "");
+        setVariable(frameCacheSize, PROP_FRAME_CACHE_SIZE.name, 1024);
 
         targetList = string_utils::split(targets, ',');
     }
@@ -286,6 +295,8 @@ struct CircuitProperties
     std::vector<std::string> targetList;
     std::string targets;
     bool synchronousMode = false;
+    std::string frameCacheFolder;
+    int32_t frameCacheSize = 0;
 };
 
 CompartmentReportPtr _openCompartmentReport(const brain::Simulation* simulation,
@@ -521,7 +532,9 @@ public:
         if (compartmentReport)
         {
             model->setSimulationHandler(std::make_shared<SimulationHandler>(
-                compartmentReport, _properties.synchronousMode));
+                compartmentReport, _properties.synchronousMode,
+                _properties.frameCacheFolder,
+                uint64_t(_properties.frameCacheSize) * 1024 * 1024));
 
             // Only keep GIDs from the report
             allGids = compartmentReport->getGIDs();
@@ -816,6 +829,8 @@ PropertyMap CircuitLoader::getCLIProperties()
     pm.setProperty(PROP_REPORT);
     pm.setProperty(PROP_TARGETS);
     pm.setProperty(Property::makeReadOnly(PROP_SYNCHRONOUS_MODE));
+    pm.setProperty(PROP_FRAME_CACHE_FOLDER);
+    pm.setProperty(PROP_FRAME_CACHE_SIZE);
     return pm;
 }
 } // namespace brayns
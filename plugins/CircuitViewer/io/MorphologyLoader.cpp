@@ -100,6 +100,11 @@ const Property PROP_USE_SDF_GEOMETRIES = {
 const Property PROP_DISABLE_SDF_BEZIER_CURVES = {
     "disableSdfBezierCurves", false,
     {"Disable SDF bezier curves", "Disable SDF bezier curves for drawing the morphologies."}};
+const Property PROP_SDF_BEZIER_SUBDIVISION_TOLERANCE = {
+    "sdfBezierSubdivisionTolerance", 0.0,
+    {"SDF bezier subdivision tolerance", "Split SDF bezier curves until their "
+     "control points deviate less than this from a straight line, for tighter "
+     "bounds. 0 disables subdivision [float]"}};
 // clang-format on
 
 const auto LOADER_NAME = "morphology";
@@ -268,9 +273,18 @@ void _addSDFSample(SDFData& sdfData, const brain::neuron::Section section,
 }
 
 void _addSDFBezierCurve(ModelData& modelData, const SDFBezier& bc,
-                        const size_t materialId)
+                        const size_t materialId, const float tolerance)
 {
-    modelData.addSDFBezier(materialId, bc);
+    if (tolerance <= 0.f)
+    {
+        modelData.addSDFBezier(materialId, bc);
+        return;
+    }
+
+    SDFBeziers pieces;
+    subdivideBezier(bc, tolerance, pieces);
+    for (const auto& piece : pieces)
+        modelData.addSDFBezier(materialId, piece);
 }
 
 /**
@@ -362,6 +376,8 @@ MorphologyLoaderParams::MorphologyLoaderParams(const PropertyMap& properties)
 
     setVariable(disableSDFBezierCurves, PROP_DISABLE_SDF_BEZIER_CURVES.name,
                 false);
+    setVariable(sdfBezierSubdivisionTolerance,
+                PROP_SDF_BEZIER_SUBDIVISION_TOLERANCE.name, 0.0);
 
     setEnumVariable(geometryQuality, "geometryQuality", GeometryQuality::high);
 }
@@ -573,7 +589,9 @@ public:
                 {
                     auto& bc = curves[i];
                     bc.userData = offset;
-                    _addSDFBezierCurve(model, bc, materialId);
+                    _addSDFBezierCurve(
+                        model, bc, materialId,
+                        _params.sdfBezierSubdivisionTolerance);
                 }
                 else
                 {
@@ -774,6 +792,7 @@ PropertyMap MorphologyLoader::getCLIProperties()
     pm.setProperty(PROP_DAMPEN_BRANCH_THICKNESS_CHANGERATE);
     pm.setProperty(PROP_USE_SDF_GEOMETRIES);
     pm.setProperty(PROP_DISABLE_SDF_BEZIER_CURVES);
+    pm.setProperty(PROP_SDF_BEZIER_SUBDIVISION_TOLERANCE);
     return pm;
 }
 } // namespace brayns
@@ -65,6 +65,7 @@ struct MorphologyLoaderParams
     bool dampenBranchThicknessChangerate = false;
     bool useSDFGeometries = false;
     bool disableSDFBezierCurves = false;
+    double sdfBezierSubdivisionTolerance = 0.0;
     GeometryQuality geometryQuality = GeometryQuality::high;
 };
 
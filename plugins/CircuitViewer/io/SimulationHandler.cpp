@@ -31,7 +31,9 @@
 namespace brayns
 {
 SimulationHandler::SimulationHandler(const CompartmentReportPtr& report,
-                                     const bool synchronousMode)
+                                     const bool synchronousMode,
+                                     const std::string& frameCacheFolder,
+                                     const uint64_t frameCacheSize)
     : _compartmentReport(report)
     , _synchronousMode(synchronousMode)
 {
@@ -54,6 +56,31 @@ SimulationHandler::SimulationHandler(const CompartmentReportPtr& report,
     BRAYNS_INFO << "Number of frames : " << _nbFrames << std::endl;
     BRAYNS_INFO << "-----------------------------------------------------------"
                 << std::endl;
+
+    if (!frameCacheFolder.empty())
+    {
+        _frameCache = std::make_shared<FrameCache>(frameCacheFolder, _frameSize,
+                                                   _nbFrames, frameCacheSize);
+        BRAYNS_INFO << "Caching up to " << _frameCache->getCapacity()
+                    << " frames in " << frameCacheFolder << std::endl;
+    }
+
+    if (!_synchronousMode)
+        _setFrameLoader([report, startTime = _startTime, endTime = _endTime,
+                         dt = _dt, cache = _frameCache](const uint32_t frame) {
+            floats data;
+            if (cache && cache->read(frame, data))
+                return data;
+
+            const auto timestamp =
+                std::min(endTime, std::max(startTime, startTime + frame * dt));
+            auto frameData = report->load(timestamp).get().data;
+            if (frameData)
+                data = std::move(*frameData);
+            if (cache)
+                cache->write(frame, data);
+            return data;
+        });
 }
 
 SimulationHandler::SimulationHandler(const SimulationHandler& rhs)
@@ -99,6 +126,13 @@ bool SimulationHandler::isReady() const
 
 void SimulationHandler::waitReady() const
 {
+    if (_isPrefetching())
+    {
+        if (!_ready)
+            _waitPrefetchedFrame(_requestedFrame);
+        return;
+    }
+
     if (_currentFrameFuture.valid())
         _currentFrameFuture.wait();
 }
@@ -107,13 +141,42 @@ void* SimulationHandler::getFrameData(uint32_t frame)
 {
     frame = _getBoundedFrame(frame);
 
-    if (!_currentFrameFuture.valid() && _currentFrame != frame)
+    if (_isPrefetching())
+    {
+        _requestedFrame = frame;
+        _ready = _takePrefetchedFrame(frame);
+        // the previous frame is still in _frameData if not read ahead yet
+        return _ready ? _getFrameData() : nullptr;
+    }
+
+    if (!_currentFrameFuture.valid())
+    {
+        // e.g. clones, which have the data of the current frame already
+        if (_currentFrame == frame)
+        {
+            _ready = true;
+            return _getFrameData();
+        }
+        if (_frameCache && _frameCache->read(frame, _frameData))
+        {
+            _handedOverFrameData = nullptr;
+            _currentFrame = frame;
+            _ready = true;
+            return _frameData.data();
+        }
         _triggerLoading(frame);
+    }
 
     if (!_makeFrameReady(frame))
         return nullptr;
 
-    return _frameData.data();
+    // the previous frame if the requested one is still loading
+    return _getFrameData();
+}
+
+bool SimulationHandler::takeFrameData(const uint32_t frame, floats& buffer)
+{
+    return _handOverFrameData(frame, buffer);
 }
 
 void SimulationHandler::_triggerLoading(const uint32_t frame)
@@ -125,6 +188,7 @@ void SimulationHandler::_triggerLoading(const uint32_t frame)
     waitReady();
 
     _ready = false;
+    _loadingFrame = frame;
     _currentFrameFuture = _compartmentReport->load(timestamp);
 }
 
@@ -150,6 +214,9 @@ bool SimulationHandler::_makeFrameReady(const uint32_t frame)
         try
         {
             _frameData = std::move(*_currentFrameFuture.get().data);
+            _handedOverFrameData = nullptr;
+            if (_frameCache)
+                _frameCache->write(_loadingFrame, _frameData);
         }
         catch (const std::exception& e)
         {
@@ -157,7 +224,7 @@ bool SimulationHandler::_makeFrameReady(const uint32_t frame)
                          << e.what() << std::endl;
             return false;
         }
-        _currentFrame = frame;
+        _currentFrame = _loadingFrame;
         _ready = true;
     }
     return true;
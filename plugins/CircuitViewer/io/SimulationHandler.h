@@ -24,6 +24,7 @@
 #include <brain/compartmentReportView.h>
 #include <brayns/api.h>
 #include <brayns/common/simulation/AbstractSimulationHandler.h>
+#include <brayns/common/simulation/FrameCache.h>
 #include <brayns/common/types.h>
 #include <brayns/engineapi/Scene.h>
 
@@ -40,8 +41,17 @@ using CompartmentReportPtr = std::shared_ptr<brain::CompartmentReportView>;
 class SimulationHandler : public AbstractSimulationHandler
 {
 public:
+    /**
+     * @param report the compartment report to read frames from
+     * @param synchronousMode wait for frames to be loaded if true
+     * @param frameCacheFolder local folder to cache frames in, no cache if
+     *        empty
+     * @param frameCacheSize maximum size of the frame cache in bytes
+     */
     SimulationHandler(const CompartmentReportPtr& report,
-                      const bool synchronousMode);
+                      const bool synchronousMode,
+                      const std::string& frameCacheFolder = {},
+                      const uint64_t frameCacheSize = 0);
     SimulationHandler(const SimulationHandler& rhs);
     ~SimulationHandler();
 
@@ -52,6 +62,7 @@ public:
     void unbind(const MaterialPtr& material) final;
 
     void* getFrameData(uint32_t frame) final;
+    bool takeFrameData(uint32_t frame, floats& buffer) final;
 
     CompartmentReportPtr getCompartmentReport() { return _compartmentReport; }
     bool isReady() const final;
@@ -68,7 +79,9 @@ private:
     double _startTime;
     double _endTime;
     std::future<brion::Frame> _currentFrameFuture;
+    uint32_t _loadingFrame{0};
     bool _ready{false};
+    uint32_t _requestedFrame{0};
     std::vector<MaterialPtr> _materials;
 };
 }
@@ -29,6 +29,7 @@
 #include <brayns/common/ActionInterface.h>
 #include <brayns/common/Progress.h>
 #include <brayns/common/geometry/Streamline.h>
+#include <brayns/common/utils/binaryUtils.h>
 #include <brayns/engineapi/Camera.h>
 #include <brayns/engineapi/Engine.h>
 #include <brayns/engineapi/Material.h>
@@ -41,6 +42,22 @@ namespace
 {
 const size_t DEFAULT_MATERIAL_ID = 0;
 const std::string MATERIAL_PROPERTY_SHADING_MODE = "shading_mode";
+
+// Binary attachment layout: number of gids, indices and vertex components as
+// uint64, followed by the gids (uint64), the indices (uint64) and the vertex
+// components (float32)
+void readStreamlinesAttachment(const brayns::uint8_ts &attachment,
+                               StreamlinesDescriptor &streamlines)
+{
+    brayns::BinaryReader reader(attachment);
+    const auto nbGids = reader.read<uint64_t>();
+    const auto nbIndices = reader.read<uint64_t>();
+    const auto nbVertices = reader.read<uint64_t>();
+    streamlines.gids = reader.readArray<uint64_t>(nbGids);
+    const auto indices = reader.readArray<uint64_t>(nbIndices);
+    streamlines.indices.assign(indices.begin(), indices.end());
+    streamlines.vertices = reader.readArray<float>(nbVertices);
+}
 } // namespace
 
 namespace dti
@@ -59,9 +76,25 @@ void DTIPlugin::init()
         std::make_unique<DTILoader>(scene, DTILoader::getCLIProperties()));
 
     PLUGIN_INFO << "Registering 'add-streamlines' endpoint" << std::endl;
-    _api->getActionInterface()->registerNotification<StreamlinesDescriptor>(
-        "add-streamlines",
-        [&](const StreamlinesDescriptor &s) { _updateStreamlines(s); });
+    _api->getActionInterface()
+        ->registerBinaryNotification<StreamlinesDescriptor>(
+            "add-streamlines", [&](StreamlinesDescriptor s,
+                                   const brayns::uint8_ts &attachment) {
+                if (!attachment.empty())
+                {
+                    try
+                    {
+                        readStreamlinesAttachment(attachment, s);
+                    }
+                    catch (const std::runtime_error &e)
+                    {
+                        PLUGIN_ERROR << "add-streamlines: " << e.what()
+                                     << std::endl;
+                        return;
+                    }
+                }
+                _updateStreamlines(s);
+            });
 
     PLUGIN_INFO << "Registering 'set-spike-simulation' endpoint" << std::endl;
     _api->getActionInterface()->registerNotification<SpikeSimulationDescriptor>(
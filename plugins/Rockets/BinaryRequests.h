@@ -32,7 +32,8 @@ const std::string METHOD_REQUEST_MODEL_UPLOAD = "request-model-upload";
 
 /**
  * Manage requests for the request-model-upload RPC by receiving and delegating
- * the blobs to the correct request.
+ * the blobs to the correct request. Blobs announced as attachments are instead
+ * collected until a binary notification takes them.
  */
 class BinaryRequests
 {
@@ -53,27 +54,75 @@ public:
         return task;
     }
 
-    void setNextChunkID(const std::string& id) { _nextChunkID = id; }
-    /** The receive and delegate of blobs to the AddModelFromBlobTask. */
-    rockets::ws::Response processMessage(const rockets::ws::Request& wsRequest)
+    void setNextChunk(const Chunk& chunk)
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        const auto key = std::make_pair(wsRequest.clientID, _nextChunkID);
-        if (_requests.count(key) == 0)
+        _nextChunkID = chunk.id;
+        _nextChunkIsAttachment = chunk.attachment;
+    }
+
+    /**
+     * The receive and delegate of blobs to the AddModelFromBlobTask, or the
+     * collection of attachments.
+     */
+    rockets::ws::Response processMessage(const rockets::ws::Request& wsRequest)
+    {
+        std::shared_ptr<AddModelFromBlobTask> request;
         {
-            BRAYNS_ERROR << "Missing RPC " << METHOD_REQUEST_MODEL_UPLOAD
-                         << " or cancelled?" << std::endl;
-            return {};
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto key = std::make_pair(wsRequest.clientID, _nextChunkID);
+            if (_nextChunkIsAttachment)
+            {
+                auto& attachment = _attachments[key];
+                attachment.insert(attachment.end(), wsRequest.message.begin(),
+                                  wsRequest.message.end());
+                return {};
+            }
+
+            auto i = _requests.find(key);
+            if (i == _requests.end())
+            {
+                BRAYNS_ERROR << "Missing RPC " << METHOD_REQUEST_MODEL_UPLOAD
+                             << " or cancelled?" << std::endl;
+                return {};
+            }
+            request = i->second;
         }
 
-        _requests[key]->appendBlob(wsRequest.message);
+        // may wait for the loader to catch up, so do not block other requests
+        // and the cancellation of this one meanwhile
+        request->appendBlob(wsRequest.message);
         return {};
     }
 
+    /**
+     * @return the attachment received for the given client and chunks ID, and
+     *         forget about it; empty if no such attachment was received.
+     */
+    uint8_ts takeAttachment(const uintptr_t clientID, const std::string& id)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        uint8_ts attachment;
+        auto i = _attachments.find(std::make_pair(clientID, id));
+        if (i == _attachments.end())
+            return attachment;
+        attachment.swap(i->second);
+        _attachments.erase(i);
+        return attachment;
+    }
+
     /** Remove pending request in case the client connection closed. */
     void removeRequest(const uintptr_t clientID)
     {
         std::lock_guard<std::mutex> lock(_mutex);
+        for (auto i = _attachments.begin(); i != _attachments.end();)
+        {
+            if (i->first.first == clientID)
+                i = _attachments.erase(i);
+            else
+                ++i;
+        }
+
         for (auto i = _requests.begin(); i != _requests.end();)
         {
             if (i->first.first != clientID)
@@ -104,7 +153,9 @@ public:
 private:
     using ClientRequestID = std::pair<uintptr_t, std::string>;
     std::map<ClientRequestID, std::shared_ptr<AddModelFromBlobTask>> _requests;
+    std::map<ClientRequestID, uint8_ts> _attachments;
     std::string _nextChunkID;
+    bool _nextChunkIsAttachment{false};
     std::mutex _mutex;
 };
 }
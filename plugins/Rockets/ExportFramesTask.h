@@ -0,0 +1,277 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "SnapshotTask.h"
+
+#include <brayns/common/simulation/AbstractSimulationHandler.h>
+#include <brayns/engineapi/Model.h>
+
+#include <chrono>
+#include <deque>
+#include <future>
+#include <iomanip>
+
+namespace brayns
+{
+struct CameraKeyframe
+{
+    Vector3d position;
+    Quaterniond orientation;
+    Vector3d target;
+};
+
+struct ExportFramesParams
+{
+    std::string path; // output directory
+    std::string format{"png"}; // FreeImage formats apply
+    size_t quality{100};
+    int samplesPerPixel{1};
+    Vector2ui size;
+    std::vector<CameraKeyframe> cameras;
+    std::vector<uint32_t> animationFrames;
+    uint32_t startFrame{0};
+    bool resume{false}; // skip frames which already exist in path
+};
+
+struct ExportFramesResult
+{
+    uint32_t framesWritten{0};
+    uint32_t framesSkipped{0};
+};
+
+/**
+ * A functor that renders a sequence of frames, one per camera keyframe and/or
+ * animation frame, to image files in a directory. Scene, renderer, camera and
+ * frame buffer are created once and reused for all frames, while encoding and
+ * writing of finished frames happens in the image writer.
+ *
+ * Files are written as <path>/<frame index>.<format>, first to a temporary
+ * file that is renamed once complete. A cancelled export can hence be resumed
+ * by sending the same request with 'resume' enabled.
+ */
+class ExportFramesFunctor : public TaskFunctor
+{
+public:
+    ExportFramesFunctor(Engine& engine, ExportFramesParams&& params,
+                        AsyncImageWriter& imageWriter)
+        : _params(std::move(params))
+        , _imageWriter(imageWriter)
+    {
+        if (_params.path.empty())
+            throw std::runtime_error("Missing output path for frame export");
+
+        const auto numCameras = _params.cameras.size();
+        const auto numAnimFrames = _params.animationFrames.size();
+        _numFrames = std::max(numCameras, numAnimFrames);
+        if (_numFrames == 0)
+            throw std::runtime_error(
+                "Need camera keyframes or animation frames to export");
+        if ((numCameras != 0 && numCameras != _numFrames) ||
+            (numAnimFrames != 0 && numAnimFrames != _numFrames))
+            throw std::runtime_error(
+                "Camera keyframes and animation frames must have the same "
+                "number of entries");
+
+        auto& parametersManager = engine.getParametersManager();
+        _animParams = std::make_unique<AnimationParameters>(
+            parametersManager.getAnimationParameters());
+        _renderingParams = std::make_unique<RenderingParameters>(
+            parametersManager.getRenderingParameters());
+        _renderingParams->setSamplesPerPixel(1);
+        _renderingParams->setSubsampling(1);
+
+        _scene = engine.createScene(*_animParams,
+                                    parametersManager.getGeometryParameters(),
+                                    parametersManager.getVolumeParameters());
+
+        _scene->copyFrom(engine.getScene());
+
+        _renderer = engine.createRenderer(*_animParams, *_renderingParams);
+        const auto& renderer = engine.getRenderer();
+        _renderer->setCurrentType(renderer.getCurrentType());
+        _renderer->clonePropertiesFrom(renderer);
+
+        _camera = engine.createCamera();
+        *_camera = engine.getCamera();
+
+        _frameBuffer = engine.createFrameBuffer("default", _params.size,
+                                                FrameBufferFormat::rgba_i8);
+    }
+
+    ExportFramesResult operator()()
+    {
+        _camera->updateProperty("aspect",
+                                double(_params.size.x) / _params.size.y);
+        _renderer->setCamera(_camera);
+        _renderer->setScene(_scene);
+
+        ExportFramesResult result;
+        try
+        {
+            for (size_t i = _params.startFrame; i < _numFrames; ++i)
+            {
+                const auto filename = _getFilename(i);
+                if (_params.resume && std::ifstream(filename).good())
+                {
+                    ++result.framesSkipped;
+                    continue;
+                }
+
+                _renderFrame(i);
+
+                // the image writer bounds the number of images waiting for
+                // encoding, report the finished ones early
+                while (!_pendingWrites.empty() &&
+                       _pendingWrites.front().second.wait_for(
+                           std::chrono::seconds(0)) ==
+                           std::future_status::ready)
+                    _waitForOldestWrite(result);
+
+                _pendingWrites.emplace_back(filename,
+                                            _imageWriter.write(
+                                                _frameBuffer->getImage(),
+                                                _params.format,
+                                                _params.quality, filename));
+            }
+        }
+        catch (...)
+        {
+            // finish what was rendered so far before cancel or error
+            _waitForPendingWrites(result);
+            throw;
+        }
+
+        _waitForPendingWrites(result);
+        return result;
+    }
+
+private:
+    std::string _getFilename(const size_t frame) const
+    {
+        std::stringstream filename;
+        filename << _params.path << "/" << std::setfill('0') << std::setw(5)
+                 << frame << "." << _params.format;
+        return filename.str();
+    }
+
+    void _renderFrame(const size_t frame)
+    {
+        if (!_params.cameras.empty())
+        {
+            const auto& keyframe = _params.cameras[frame];
+            _camera->set(keyframe.position, keyframe.orientation,
+                         keyframe.target);
+        }
+        _camera->commit();
+
+        if (!_params.animationFrames.empty())
+            _animParams->setFrame(_params.animationFrames[frame]);
+
+        _commitScene();
+        _renderer->commit();
+
+        std::stringstream msg;
+        msg << "Render frame " << frame + 1 << " of " << _numFrames << " ...";
+
+        const auto numFramesToRender = _numFrames - _params.startFrame;
+        _frameBuffer->clear();
+        while (_frameBuffer->numAccumFrames() !=
+                   size_t(_params.samplesPerPixel) &&
+               !_renderer->hasConverged(*_frameBuffer))
+        {
+            _renderer->render(_frameBuffer);
+            _frameBuffer->incrementAccumFrames();
+
+            progress(msg.str(),
+                     1.f / (numFramesToRender * _params.samplesPerPixel),
+                     (frame - _params.startFrame +
+                      float(_frameBuffer->numAccumFrames()) /
+                          _params.samplesPerPixel) /
+                         numFramesToRender);
+        }
+    }
+
+    /**
+     * Commit the scene until the simulation handlers have the data of the
+     * animation frame, which may be loaded asynchronously.
+     */
+    void _commitScene()
+    {
+        _scene->commit();
+        for (;;)
+        {
+            bool ready = true;
+            _scene->visitModels([&ready](Model& model) {
+                auto handler = model.getSimulationHandler();
+                if (handler && !handler->isReady())
+                {
+                    handler->waitReady();
+                    ready = false;
+                }
+            });
+            if (ready)
+                return;
+
+            cancelCheck();
+            _scene->commit();
+        }
+    }
+
+    void _waitForOldestWrite(ExportFramesResult& result)
+    {
+        auto write = std::move(_pendingWrites.front());
+        _pendingWrites.pop_front();
+        if (!write.second.get())
+            throw std::runtime_error("Failed to write " + write.first);
+        ++result.framesWritten;
+    }
+
+    void _waitForPendingWrites(ExportFramesResult& result)
+    {
+        std::exception_ptr error;
+        while (!_pendingWrites.empty())
+        {
+            try
+            {
+                _waitForOldestWrite(result);
+            }
+            catch (...)
+            {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    ExportFramesParams _params;
+    size_t _numFrames{0};
+    std::unique_ptr<AnimationParameters> _animParams;
+    std::unique_ptr<RenderingParameters> _renderingParams;
+    FrameBufferPtr _frameBuffer;
+    CameraPtr _camera;
+    RendererPtr _renderer;
+    ScenePtr _scene;
+    AsyncImageWriter& _imageWriter;
+    std::deque<std::pair<std::string, std::future<bool>>> _pendingWrites;
+};
+} // namespace brayns
@@ -0,0 +1,88 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ImageFrame.h"
+
+#include <brayns/engineapi/Camera.h>
+
+#include <cstring>
+
+namespace
+{
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+template <typename T>
+char* write(char* dst, const T value)
+{
+    memcpy(dst, &value, sizeof(T));
+    return dst + sizeof(T);
+}
+
+void hash(uint64_t& value, const double element)
+{
+    const auto bytes = reinterpret_cast<const uint8_t*>(&element);
+    for (size_t i = 0; i < sizeof(double); ++i)
+    {
+        value ^= bytes[i];
+        value *= FNV_PRIME;
+    }
+}
+} // namespace
+
+namespace brayns
+{
+std::vector<char> packImageFrame(const ImageFrameHeader& header,
+                                 const uint8_t* data, const size_t size)
+{
+    std::vector<char> frame(ImageFrameHeader::SIZE + size);
+
+    char* ptr = frame.data();
+    ptr = write(ptr, ImageFrameHeader::MAGIC);
+    ptr = write(ptr, ImageFrameHeader::VERSION);
+    ptr = write(ptr, ImageFrameHeader::SIZE);
+    ptr = write(ptr, header.frameID);
+    ptr = write(ptr, header.cameraHash);
+    ptr = write(ptr, header.timestamp);
+    ptr = write(ptr, header.samplesPerPixel);
+    ptr = write(ptr, header.renderTime);
+    ptr = write(ptr, header.encodeTime);
+    ptr = write(ptr, header.width);
+    write(ptr, header.height);
+
+    memcpy(frame.data() + ImageFrameHeader::SIZE, data, size);
+    return frame;
+}
+
+uint64_t hashCamera(const Camera& camera)
+{
+    uint64_t value = FNV_OFFSET_BASIS;
+
+    const auto& position = camera.getPosition();
+    const auto& orientation = camera.getOrientation();
+    const auto& target = camera.getTarget();
+    for (const double element :
+         {position.x, position.y, position.z, orientation.x, orientation.y,
+          orientation.z, orientation.w, target.x, target.y, target.z})
+    {
+        hash(value, element);
+    }
+    return value;
+}
+} // namespace brayns
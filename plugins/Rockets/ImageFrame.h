@@ -0,0 +1,113 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <brayns/common/types.h>
+
+namespace brayns
+{
+/**
+ * Binary header which precedes each streamed JPEG image if framing was enabled
+ * with 'image-streaming-mode'. The header is serialized field by field in the
+ * order below, little-endian and without padding; the JPEG data follows
+ * directly after 'headerSize' bytes.
+ */
+struct ImageFrameHeader
+{
+    static constexpr uint32_t MAGIC = 0x46495242; // "BRIF"
+    static constexpr uint16_t VERSION = 1;
+    static constexpr uint16_t SIZE = 48;
+
+    // magic, version and headerSize (uint32, uint16, uint16) come first
+    uint64_t frameID{0};
+    uint64_t cameraHash{0};
+    uint64_t timestamp{0};       //!< microseconds since epoch
+    uint32_t samplesPerPixel{0}; //!< accumulated samples per pixel
+    uint32_t renderTime{0};      //!< microseconds, smoothed
+    uint32_t encodeTime{0};      //!< microseconds
+    uint16_t width{0};
+    uint16_t height{0};
+};
+
+/**
+ * @return the serialized header followed by the given image data, ready to be
+ *         sent as one binary websocket message.
+ */
+std::vector<char> packImageFrame(const ImageFrameHeader& header,
+                                 const uint8_t* data, size_t size);
+
+/**
+ * @return the FNV-1a hash over the bytes of the camera position (x, y, z),
+ *         orientation (x, y, z, w) and target (x, y, z), each as 64-bit
+ *         doubles in that order. Clients can compute the same hash for the
+ *         camera they sent to match images against camera updates.
+ */
+uint64_t hashCamera(const Camera& camera);
+
+/**
+ * Back-pressure for framed image streaming: once maxPendingFrames sent frames
+ * are not acknowledged, frames are skipped until the next acknowledgement.
+ * Acknowledgements of frames which were not sent yet are rejected, as are
+ * outdated ones.
+ */
+class ImageFrameThrottle
+{
+public:
+    /** Limit the unacknowledged frames, 0 for no limit; resets pending state */
+    void setMaxPendingFrames(const size_t maxPendingFrames)
+    {
+        _maxPendingFrames = maxPendingFrames;
+        _ackedFrameID = _frameID;
+        _skippedFrame = false;
+    }
+
+    /** @return the ID for the next frame to send */
+    uint64_t nextFrameID() { return ++_frameID; }
+
+    /** @return true if the current frame has to be skipped */
+    bool isBlocked()
+    {
+        if (_maxPendingFrames == 0)
+            return false;
+        _skippedFrame = _frameID - _ackedFrameID >= _maxPendingFrames;
+        return _skippedFrame;
+    }
+
+    /**
+     * Acknowledge the reception of the given frame and all before.
+     * @return true if a frame was skipped and the latest one should be sent
+     */
+    bool acknowledge(const uint64_t frameID)
+    {
+        if (frameID > _frameID || frameID <= _ackedFrameID)
+            return false;
+        _ackedFrameID = frameID;
+        const bool resume = _skippedFrame;
+        _skippedFrame = false;
+        return resume;
+    }
+
+private:
+    size_t _maxPendingFrames{0};
+    uint64_t _frameID{0};
+    uint64_t _ackedFrameID{0};
+    bool _skippedFrame{false};
+};
+}
@@ -0,0 +1,224 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include "ImageWriter.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#ifdef BRAYNS_USE_TIFF
+#include <tiffio.h>
+#endif
+
+namespace brayns
+{
+bool writeImageToFile(freeimage::ImagePtr image, const std::string& format,
+                      const size_t quality, const std::string& path)
+{
+    auto fif = format == "jpg" ? FIF_JPEG
+                               : FreeImage_GetFIFFromFormat(format.c_str());
+    if (fif == FIF_UNKNOWN)
+    {
+        std::cerr << "Unknown format: " << format << std::endl;
+        return false;
+    }
+
+    const auto type = FreeImage_GetImageType(image.get());
+    if (!FreeImage_FIFSupportsExportType(fif, type))
+    {
+        std::cerr << "Format " << format << " does not support this image type"
+                  << std::endl;
+        return false;
+    }
+
+    if (fif == FIF_JPEG)
+        image.reset(FreeImage_ConvertTo24Bits(image.get()));
+
+    int flags = quality;
+    if (fif == FIF_TIFF)
+        flags = TIFF_NONE;
+    else if (fif == FIF_EXR)
+        flags = EXR_DEFAULT;
+
+    freeimage::MemoryPtr memory(FreeImage_OpenMemory());
+
+    FreeImage_SaveToMemory(fif, image.get(), memory.get(), flags);
+
+    BYTE* pixels = nullptr;
+    DWORD numPixels = 0;
+    FreeImage_AcquireMemory(memory.get(), &pixels, &numPixels);
+
+    std::ofstream file;
+    file.open(path, std::ios_base::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to create " << path << std::endl;
+        return false;
+    }
+
+    file.write((char*)pixels, numPixels);
+    file.close();
+    return file.good();
+}
+
+AsyncImageWriter::AsyncImageWriter(const size_t maxQueueSize)
+    : _maxQueueSize(maxQueueSize)
+    , _thread([this] { _run(); })
+{
+}
+
+AsyncImageWriter::~AsyncImageWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+}
+
+std::future<bool> AsyncImageWriter::write(freeimage::ImagePtr image,
+                                          const std::string& format,
+                                          const size_t quality,
+                                          const std::string& path,
+                                          WrittenCallback callback)
+{
+    Job job{std::move(image), format, quality, path, {}, std::move(callback)};
+    auto written = job.written.get_future();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [&] { return _jobs.size() < _maxQueueSize; });
+    _jobs.push_back(std::move(job));
+    _condition.notify_all();
+    return written;
+}
+
+void AsyncImageWriter::_run()
+{
+    for (;;)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [&] { return _stop || !_jobs.empty(); });
+            if (_jobs.empty())
+                return;
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+        _condition.notify_all();
+
+        const auto tmpPath = job.path + ".tmp";
+        const bool written =
+            writeImageToFile(std::move(job.image), job.format, job.quality,
+                             tmpPath) &&
+            std::rename(tmpPath.c_str(), job.path.c_str()) == 0;
+        if (!written)
+            std::remove(tmpPath.c_str());
+
+        if (job.callback)
+            job.callback(job.path, written);
+        job.written.set_value(written);
+    }
+}
+
+TiffStripWriter::TiffStripWriter(const std::string& path,
+                                 const Vector2ui& size,
+                                 const uint32_t rowsPerStrip)
+    : _path(path)
+    , _tmpPath(path + ".tmp")
+    , _size(size)
+{
+#ifdef BRAYNS_USE_TIFF
+    // 'w8' writes BigTIFF, needed beyond 4 GB including the strip tables
+    const uint64_t imageSize = uint64_t(size.x) * size.y * 4;
+    const bool bigTiff =
+        imageSize > std::numeric_limits<uint32_t>::max() - (1 << 20);
+    _tiff = TIFFOpen(_tmpPath.c_str(), bigTiff ? "w8" : "w");
+    if (!_tiff)
+        throw std::runtime_error("Failed to create " + path);
+
+    const uint16_t extraSamples[] = {EXTRASAMPLE_UNASSALPHA};
+    TIFFSetField(_tiff, TIFFTAG_IMAGEWIDTH, size.x);
+    TIFFSetField(_tiff, TIFFTAG_IMAGELENGTH, size.y);
+    TIFFSetField(_tiff, TIFFTAG_BITSPERSAMPLE, 8);
+    TIFFSetField(_tiff, TIFFTAG_SAMPLESPERPIXEL, 4);
+    TIFFSetField(_tiff, TIFFTAG_EXTRASAMPLES, 1, extraSamples);
+    TIFFSetField(_tiff, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_RGB);
+    TIFFSetField(_tiff, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+    TIFFSetField(_tiff, TIFFTAG_COMPRESSION, COMPRESSION_NONE);
+    TIFFSetField(_tiff, TIFFTAG_ROWSPERSTRIP, rowsPerStrip);
+#else
+    (void)rowsPerStrip;
+    throw std::runtime_error("Writing " + path +
+                             " needs Brayns to be built with libtiff");
+#endif
+}
+
+TiffStripWriter::~TiffStripWriter()
+{
+#ifdef BRAYNS_USE_TIFF
+    if (_tiff)
+    {
+        TIFFClose(_tiff);
+        std::remove(_tmpPath.c_str());
+    }
+#endif
+}
+
+void TiffStripWriter::writeStrip(const uint8_t* rgba, const uint32_t numRows)
+{
+#ifdef BRAYNS_USE_TIFF
+    if (_writtenRows + numRows > _size.y)
+        throw std::runtime_error("Too many rows for " + _path);
+
+    const tmsize_t numBytes = tmsize_t(_size.x) * numRows * 4;
+    if (TIFFWriteEncodedStrip(_tiff, _strip, const_cast<uint8_t*>(rgba),
+                              numBytes) != numBytes)
+        throw std::runtime_error("Failed to write " + _path);
+    ++_strip;
+    _writtenRows += numRows;
+#else
+    (void)rgba;
+    (void)numRows;
+#endif
+}
+
+void TiffStripWriter::finish()
+{
+#ifdef BRAYNS_USE_TIFF
+    if (_writtenRows != _size.y)
+        throw std::runtime_error("Missing rows for " + _path);
+
+    // writes the pending data and the image directory
+    const bool flushed = TIFFFlush(_tiff) == 1;
+    TIFFClose(_tiff);
+    _tiff = nullptr;
+    if (!flushed || std::rename(_tmpPath.c_str(), _path.c_str()) != 0)
+    {
+        std::remove(_tmpPath.c_str());
+        throw std::runtime_error("Failed to write " + _path);
+    }
+#endif
+}
+}
@@ -0,0 +1,141 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include <brayns/common/types.h>
+#include <brayns/common/utils/imageUtils.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+// libtiff's TIFF handle
+struct tiff;
+
+namespace brayns
+{
+/**
+ * Encode the given image in the given FreeImage format and write it to path.
+ * Floating point images are supported by formats like EXR and TIFF.
+ *
+ * @return false if the format is unknown or does not support the image type,
+ *         or if the file could not be written.
+ */
+bool writeImageToFile(freeimage::ImagePtr image, const std::string& format,
+                      size_t quality, const std::string& path);
+
+/**
+ * Encodes and writes images to disk in order on a dedicated thread, so
+ * rendering can continue while images go to (potentially slow) storage.
+ * Images are written to a temporary file next to the path first, which is
+ * renamed once complete, so readers never see partially written files.
+ */
+class AsyncImageWriter
+{
+public:
+    /** Called on the writer thread with the path and the write result. */
+    using WrittenCallback = std::function<void(const std::string&, bool)>;
+
+    /** @param maxQueueSize number of images to queue before write() blocks */
+    explicit AsyncImageWriter(size_t maxQueueSize = 4);
+
+    /** Writes all queued images before returning. */
+    ~AsyncImageWriter();
+
+    /**
+     * Queue the image for writing, blocks while the queue is full.
+     *
+     * @param callback optional, called once the image is written or failed
+     * @return the future result of writeImageToFile() for this image
+     */
+    std::future<bool> write(freeimage::ImagePtr image,
+                            const std::string& format, size_t quality,
+                            const std::string& path,
+                            WrittenCallback callback = {});
+
+private:
+    struct Job
+    {
+        freeimage::ImagePtr image;
+        std::string format;
+        size_t quality{100};
+        std::string path;
+        std::promise<bool> written;
+        WrittenCallback callback;
+    };
+
+    void _run();
+
+    const size_t _maxQueueSize;
+    std::deque<Job> _jobs;
+    bool _stop{false};
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::thread _thread;
+};
+
+/**
+ * Writes an 8-bit RGBA TIFF image strip by strip from top to bottom with
+ * libtiff, so images larger than the available memory can be written while
+ * they are rendered. Uses BigTIFF if the image exceeds the 4 GB limit of
+ * classic TIFF. Like AsyncImageWriter, it writes to a temporary file which is
+ * renamed by finish().
+ */
+class TiffStripWriter
+{
+public:
+    /**
+     * Create the file, throws if libtiff is not available or the file cannot
+     * be created.
+     *
+     * @param path the file to write
+     * @param size the size of the complete image in pixels
+     * @param rowsPerStrip the number of rows of all strips but the last one
+     */
+    TiffStripWriter(const std::string& path, const Vector2ui& size,
+                    uint32_t rowsPerStrip);
+
+    /** Removes the temporary file if finish() was not called. */
+    ~TiffStripWriter();
+
+    /**
+     * Append the next strip, throws if it cannot be written.
+     *
+     * @param rgba the pixels of the strip, top row first
+     * @param numRows the number of rows of the strip
+     */
+    void writeStrip(const uint8_t* rgba, uint32_t numRows);
+
+    /** Close the file and rename it to the path, throws on failure. */
+    void finish();
+
+private:
+    const std::string _path;
+    const std::string _tmpPath;
+    const Vector2ui _size;
+    tiff* _tiff{nullptr};
+    uint32_t _strip{0};
+    uint32_t _writtenRows{0};
+};
+}
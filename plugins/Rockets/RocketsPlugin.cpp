@@ -42,7 +42,9 @@
 #include <rockets/server.h>
 
 #include "BinaryRequests.h"
+#include "ImageFrame.h"
 #include "ImageGenerator.h"
+#include "ImageWriter.h"
 #include "Throttle.h"
 
 #include <atomic>
@@ -87,7 +89,9 @@ const std::string ENDPOINT_VERSION = "version";
 
 // JSONRPC async requests
 const std::string METHOD_ADD_MODEL = "add-model";
+const std::string METHOD_EXPORT_FRAMES = "export-frames";
 const std::string METHOD_SNAPSHOT = "snapshot";
+const std::string METHOD_SNAPSHOT_WRITTEN = "snapshot-written"; // notification
 // METHOD_REQUEST_MODEL_UPLOAD from BinaryRequests.h
 
 // JSONRPC synchronous requests
@@ -103,6 +107,7 @@ const std::string METHOD_GET_VIDEOSTREAM = "get-videostream";
 const std::string METHOD_IMAGE_JPEG = "image-jpeg";
 const std::string METHOD_SET_STREAMING_METHOD = "image-streaming-mode";
 const std::string METHOD_TRIGGER_JPEG_STREAM = "trigger-jpeg-stream";
+const std::string METHOD_IMAGE_ACK = "image-ack";
 const std::string METHOD_INSPECT = "inspect";
 const std::string METHOD_MODEL_PROPERTIES_SCHEMA = "model-properties-schema";
 const std::string METHOD_REMOVE_CLIP_PLANES = "remove-clip-planes";
@@ -406,6 +411,26 @@ public:
         });
     }
 
+    void _registerBinaryNotification(const std::string& name,
+                                     const BinaryParamFunc& action)
+    {
+        _jsonrpcServer->connect(name, [action, this](const auto& request) {
+            ScopedCurrentClient scope(this->_currentClientID, request.clientID);
+
+            rapidjson::Document document;
+            document.Parse(request.message.c_str());
+
+            uint8_ts attachment;
+            if (document.IsObject() && document.HasMember("chunks_id") &&
+                document["chunks_id"].IsString())
+            {
+                attachment = _binaryRequests.takeAttachment(
+                    request.clientID, document["chunks_id"].GetString());
+            }
+            action(request.message, attachment);
+        });
+    }
+
     void processDelayedNotifies()
     {
         // call pending notifies from delayed throttle threads here as
@@ -979,6 +1004,7 @@ public:
         _handleImageJPEG();
         _handleTriggerImageStream();
         _handleSetImageStreamingMode();
+        _handleImageAck();
         _handleRenderer();
         _handleVersion();
 
@@ -1004,6 +1030,7 @@ public:
         _handleExitLater();
         _handleResetCamera();
         _handleSnapshot();
+        _handleExportFrames();
 
         _handleRequestModelUpload();
         _handleChunk();
@@ -1087,17 +1114,15 @@ public:
         if (elapsed < duration)
             return;
 
+        if (_isImageStreamBlocked())
+            return;
+
         _leftover = elapsed - duration;
         for (; _leftover > duration;)
             _leftover -= duration;
         _timer.start();
 
-        const auto image =
-            _imageGenerator.createJPEG(frameBuffer,
-                                       params.getJpegCompression());
-        if (image.size > 0)
-            _rocketsServer->broadcastBinary((const char*)image.data.get(),
-                                            image.size);
+        _broadcastJpeg(frameBuffer);
     }
 
     void _broadcastControlledImageJpeg()
@@ -1114,15 +1139,65 @@ public:
             return;
         }
 
+        if (_isImageStreamBlocked())
+            return;
+
         _controlledStreamingFlag = false;
+        _broadcastJpeg(frameBuffer);
+    }
+
+    /**
+     * Back-pressure for framed image streaming: if the clients did not
+     * acknowledge enough of the sent frames, the current frame is skipped and
+     * the latest one is sent once the next acknowledgement arrives.
+     */
+    bool _isImageStreamBlocked()
+    {
+        return _imageFramed && _imageThrottle.isBlocked();
+    }
+
+    void _broadcastJpeg(FrameBuffer& frameBuffer)
+    {
         const auto& params = _parametersManager.getApplicationParameters();
 
+        Timer encodeTimer;
+        encodeTimer.start();
         const auto image =
             _imageGenerator.createJPEG(frameBuffer,
                                        params.getJpegCompression());
-        if (image.size > 0)
+        encodeTimer.stop();
+        if (image.size == 0)
+            return;
+
+        if (!_imageFramed)
+        {
             _rocketsServer->broadcastBinary((const char*)image.data.get(),
                                             image.size);
+            return;
+        }
+
+        const auto fps = _engine.getStatistics().getFPS();
+        const auto spp = _parametersManager.getRenderingParameters()
+                             .getSamplesPerPixel();
+        const auto& frameSize = frameBuffer.getSize();
+
+        ImageFrameHeader header;
+        header.frameID = _imageThrottle.nextFrameID();
+        header.cameraHash = hashCamera(_engine.getCamera());
+        header.timestamp =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch())
+                .count();
+        // the engine increments the accumulation count after postRender()
+        header.samplesPerPixel = (frameBuffer.numAccumFrames() + 1) * spp;
+        header.renderTime = fps > 0 ? uint32_t(1000000. / fps) : 0;
+        header.encodeTime = encodeTimer.microseconds();
+        header.width = frameSize.x;
+        header.height = frameSize.y;
+
+        const auto frame =
+            packImageFrame(header, image.data.get(), image.size);
+        _rocketsServer->broadcastBinary(frame.data(), frame.size());
     }
 
 #ifdef BRAYNS_USE_FFMPEG
@@ -1142,8 +1217,13 @@ public:
         if (fps == 0)
             return;
 
-        if (_encoder && _encoder->kbps != _videoParams.kbps)
+        if (_encoder &&
+            (_encoder->kbps != _videoParams.kbps ||
+             _encoder->accumulateWhileEncoding !=
+                 _videoParams.accumulateWhileEncoding))
+        {
             _encoder.reset();
+        }
 
         auto& frameBuffer = _engine.getFrameBuffer();
         if (!_encoder)
@@ -1155,25 +1235,31 @@ public:
             if (height % 2 != 0)
                 height += 1;
 
-            _encoder =
-                std::make_unique<Encoder>(width, height, fps, _videoParams.kbps,
-                                          [&rs = _rocketsServer](auto a,
-                                                                 auto b) {
-                                              rs->broadcastBinary(a, b);
-                                          });
+            _encoder = std::make_unique<Encoder>(
+                width, height, fps, _videoParams.kbps,
+                [&rs = _rocketsServer](auto a, auto b) {
+                    rs->broadcastBinary(a, b);
+                },
+                _videoParams.accumulateWhileEncoding);
         }
 
         if (_videoUpdatedResponse)
             _videoUpdatedResponse();
         _videoUpdatedResponse = nullptr;
 
+        auto& stats = _engine.getStatistics();
+        stats.setEncoderFPS(_encoder->getEncoderFPS());
+        stats.setDroppedFrames(_encoder->getDroppedFrames());
+
         if (frameBuffer.getFrameBufferFormat() == FrameBufferFormat::none ||
             !frameBuffer.isModified())
         {
             return;
         }
 
-        _encoder->encode(frameBuffer);
+        // the last frame of an accumulation must reach the stream, even if
+        // the encoder is still busy
+        _encoder->encode(frameBuffer, !_engine.continueRendering());
     }
 #endif
 
@@ -1340,16 +1426,58 @@ public:
             METHOD_SNAPSHOT, "Make a snapshot of the current view",
             Execution::async, "settings",
             "Snapshot settings for quality and size"};
-        auto func = [&engine = _engine,
-                     &imageGenerator = _imageGenerator](auto&& params,
-                                                        const auto) {
+        auto func = [&, &engine = _engine, &imageGenerator = _imageGenerator,
+                     &imageWriter = _imageWriter](auto&& params,
+                                                  const auto clientID) {
+            // files are written after the reply, tell the client about each
+            auto written = [&, clientID](const std::string& path,
+                                         const bool success) {
+                _notifySnapshotWritten({path, success}, clientID);
+            };
             using SnapshotTask = DeferredTask<ImageGenerator::ImageBase64>;
             return std::make_shared<SnapshotTask>(
-                SnapshotFunctor{engine, std::move(params), imageGenerator});
+                SnapshotFunctor{engine, std::move(params), imageGenerator,
+                                imageWriter, written});
         };
         _handleTask<SnapshotParams, ImageGenerator::ImageBase64>(desc, func);
     }
 
+    void _notifySnapshotWritten(const SnapshotFile& file,
+                                const uintptr_t clientID)
+    {
+        _delayedNotify([&, json = to_json(file), clientID] {
+            try
+            {
+                const auto& msg =
+                    rockets::jsonrpc::makeNotification(METHOD_SNAPSHOT_WRITTEN,
+                                                       json);
+                _rocketsServer->broadcastText(msg, {clientID});
+            }
+            catch (const std::exception& e)
+            {
+                BRAYNS_ERROR << "Error sending notification: " << e.what()
+                             << std::endl;
+            }
+        });
+    }
+
+    void _handleExportFrames()
+    {
+        const RpcParameterDescription desc{
+            METHOD_EXPORT_FRAMES,
+            "Render a sequence of camera keyframes and/or animation frames to "
+            "image files",
+            Execution::async, "settings",
+            "Output directory, image settings and frames to export"};
+        auto func = [&engine = _engine,
+                     &imageWriter = _imageWriter](auto&& params, const auto) {
+            using ExportFramesTask = DeferredTask<ExportFramesResult>;
+            return std::make_shared<ExportFramesTask>(
+                ExportFramesFunctor{engine, std::move(params), imageWriter});
+        };
+        _handleTask<ExportFramesParams, ExportFramesResult>(desc, func);
+    }
+
     void _handleTriggerImageStream()
     {
         _handleRPC({METHOD_TRIGGER_JPEG_STREAM,
@@ -1363,7 +1491,10 @@ public:
             {METHOD_SET_STREAMING_METHOD,
              "Set the image streaming method between automatic or "
              "controlled",
-             "type", "Streaming type, either \"stream\" or \"quanta\""},
+             "type",
+             "Streaming type, either \"stream\" or \"quanta\"; \"framed\" "
+             "prepends a binary header to each image, \"max_pending_frames\" "
+             "limits the number of unacknowledged framed images"},
             [&](const ImageStreamingMethod& method) {
                 if (method.type == "quanta")
                 {
@@ -1372,6 +1503,22 @@ public:
                 }
                 else
                     _useControlledStream = false;
+
+                _imageFramed = method.framed;
+                _imageThrottle.setMaxPendingFrames(method.maxPendingFrames);
+            });
+    }
+
+    void _handleImageAck()
+    {
+        _handleRPC<ImageAck>(
+            {METHOD_IMAGE_ACK,
+             "Acknowledge the reception of a framed image to allow the next "
+             "frames to be streamed",
+             "ack", "ID of the received frame from the image header"},
+            [&](const ImageAck& ack) {
+                if (_imageThrottle.acknowledge(ack.frameID))
+                    _engine.triggerRender();
             });
     }
 
@@ -1395,10 +1542,11 @@ public:
         const RpcParameterDescription desc{
             METHOD_CHUNK,
             "Indicate sending of a binary chunk after this message", "chunk",
-            "object with an ID of the chunk"};
+            "object with an ID of the chunk; if attachment is true, the chunk "
+            "is kept for a subsequent RPC referencing it by chunks_id"};
 
         _handleRPC<Chunk>(desc, [&req = _binaryRequests](const auto& chunk) {
-            req.setNextChunkID(chunk.id);
+            req.setNextChunk(chunk);
         });
     }
 
@@ -2339,6 +2487,7 @@ public:
     bool _manualProcessing{true};
 
     ImageGenerator _imageGenerator;
+    AsyncImageWriter _imageWriter;
 
     Timer _timer;
     float _leftover{0.f};
@@ -2357,6 +2506,11 @@ public:
     // Flag used to control the frame send when _useControlledStream = true
     std::atomic<bool> _controlledStreamingFlag{false};
 
+    // Binary header and back-pressure for the JPEG stream; acknowledgements
+    // from any client release the next frame
+    bool _imageFramed{false};
+    ImageFrameThrottle _imageThrottle;
+
     // Wether a scheduled shutdown is running at the momment
     bool _scheduledShutdownActive{false};
     // Flag to cancel current scheduled shutdown
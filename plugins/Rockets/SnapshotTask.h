@@ -23,6 +23,7 @@
 #include <brayns/common/tasks/Task.h>
 
 #include "ImageGenerator.h"
+#include "ImageWriter.h"
 #include <brayns/common/utils/stringUtils.h>
 #include <brayns/engineapi/Camera.h>
 #include <brayns/engineapi/Engine.h>
@@ -32,6 +33,7 @@
 
 #include <brayns/parameters/ParametersManager.h>
 
+#include <cstring>
 #include <fstream>
 
 namespace brayns
@@ -49,22 +51,41 @@ struct SnapshotParams
     std::string format; // FreeImage formats apply
     std::string name;
     std::string filePath;
+    uint32_t tileSize{0}; // render in tiles of this size if not 0, tif(f) only
+    bool hdr{false};      // floating point colors, needs EXR or TIFF format
+    bool depth{false};    // also write depth to <filePath>_depth.<format>
 };
 
 /**
  * A functor for snapshot rendering and conversion to a base64-encoded image for
- * the web client.
+ * the web client. Snapshots with a file path are encoded and written by the
+ * image writer; the task finishes once rendering is done and the given
+ * callback reports each file once it is written or failed.
  */
 class SnapshotFunctor : public TaskFunctor
 {
 public:
     SnapshotFunctor(Engine& engine, SnapshotParams&& params,
-                    ImageGenerator& imageGenerator)
+                    ImageGenerator& imageGenerator,
+                    AsyncImageWriter& imageWriter,
+                    AsyncImageWriter::WrittenCallback written = {})
         : _params(std::move(params))
         , _camera(engine.createCamera())
         , _imageGenerator(imageGenerator)
+        , _imageWriter(imageWriter)
+        , _written(std::move(written))
         , _engine(engine)
     {
+        // Models can only be shared with the live scene if they don't need to
+        // be created differently, i.e. for other geometry/volume parameters or
+        // for another simulation frame
+        const auto liveFrame =
+            engine.getParametersManager().getAnimationParameters().getFrame();
+        const bool shareModels =
+            !_params.geometryParams && !_params.volumeParams &&
+            (!_params.animParams ||
+             _params.animParams->getFrame() == liveFrame);
+
         if (_params.animParams == nullptr)
         {
             _params.animParams = std::make_unique<AnimationParameters>(
@@ -108,13 +129,14 @@ public:
         else
             *_camera = engine.getCamera();
 
-        _scene->copyFrom(engine.getScene());
+        if (shareModels)
+            _scene->shareModelsFrom(engine.getScene());
+        else
+            _scene->copyFrom(engine.getScene());
     }
 
     ImageGenerator::ImageBase64 operator()()
     {
-        _scene->commit();
-
         _camera->updateProperty("aspect",
                                 double(_params.size.x) / _params.size.y);
         _camera->commit();
@@ -127,7 +149,12 @@ public:
 
         _renderer->setCamera(_camera);
         _renderer->setScene(_scene);
-        _renderer->commit();
+        {
+            auto lock = _scene->acquireRenderAccess();
+            _sharesModels = _scene->sharesModels();
+            _scene->commit();
+            _renderer->commit();
+        }
 
         std::stringstream msg;
         msg << "Render snapshot";
@@ -137,82 +164,188 @@ public:
 
         const auto isStereo = _camera->hasProperty("stereo") &&
                               _camera->getProperty<bool>("stereo");
+
+        if (_params.hdr || _params.depth)
+        {
+            if (isStereo || _params.filePath.empty() || _params.tileSize > 0)
+                throw std::runtime_error(
+                    "HDR and depth snapshots need a file path, a mono camera "
+                    "and no tiling");
+            const auto fif = FreeImage_GetFIFFromFormat(_params.format.c_str());
+            if (fif != FIF_EXR && fif != FIF_TIFF)
+                throw std::runtime_error(
+                    "HDR and depth snapshots need the exr or tiff format");
+        }
+
+        if (_params.tileSize > 0)
+        {
+            if (isStereo || _params.filePath.empty())
+                throw std::runtime_error(
+                    "Tiled snapshots need a file path and a mono camera");
+            // other formats need the complete image in memory to encode it
+            if (_params.format != "tif" && _params.format != "tiff")
+                throw std::runtime_error(
+                    "Tiled snapshots need the tif or tiff format");
+            _renderTiles(msg.str());
+            return ImageGenerator::ImageBase64();
+        }
+
         const auto names = isStereo ? strings{"0L", "0R"} : strings{"default"};
         std::vector<FrameBufferPtr> frameBuffers;
         for (const auto& name : names)
             frameBuffers.push_back(
                 _engine.createFrameBuffer(name, _params.size,
-                                          FrameBufferFormat::rgba_i8));
+                                          _params.hdr
+                                              ? FrameBufferFormat::rgba_f32
+                                              : FrameBufferFormat::rgba_i8));
 
-        while (frameBuffers[0]->numAccumFrames() !=
-               size_t(_params.samplesPerPixel))
+        bool converged = false;
+        while (!converged && frameBuffers[0]->numAccumFrames() !=
+                                 size_t(_params.samplesPerPixel))
         {
-            for (auto frameBuffer : frameBuffers)
-            {
-                _camera->setBufferTarget(frameBuffer->getName());
-                _camera->markModified(false);
-                _camera->commit();
-                _camera->resetModified();
-                _renderer->render(frameBuffer);
-                frameBuffer->incrementAccumFrames();
-            }
+            converged = _renderFrame(frameBuffers);
 
             progress(msg.str(), 1.f / frameBuffers[0]->numAccumFrames(),
                      float(frameBuffers[0]->numAccumFrames()) /
                          _params.samplesPerPixel);
         }
 
-        if(!_params.filePath.empty() && frameBuffers.size() == 1)
+        if (!_params.filePath.empty() && frameBuffers.size() == 1)
         {
-            auto& fb = *frameBuffers[0];
-            _writeToDisk(fb);
+            freeimage::ImagePtr depthImage;
+            if (_params.depth)
+            {
+                depthImage = frameBuffers[0]->getDepthImage();
+                if (!depthImage)
+                    throw std::runtime_error(
+                        "The engine does not provide a depth buffer");
+            }
 
+            const auto extension = "." + _params.format;
+            _writeToDisk(frameBuffers[0]->getImage(),
+                         _params.filePath + extension);
+            if (depthImage)
+                _writeToDisk(std::move(depthImage),
+                             _params.filePath + "_depth" + extension);
             return ImageGenerator::ImageBase64();
         }
         else
             return _imageGenerator.createImage(frameBuffers, _params.format,
-                                            _params.quality);
+                                               _params.quality);
     }
 
 private:
-    void _writeToDisk(FrameBuffer& fb)
+    /**
+     * Accumulate one frame into each frame buffer. Accumulation starts over if
+     * the live scene stopped sharing its models since the last frame.
+     * @return true if all frame buffers reached the variance threshold.
+     */
+    bool _renderFrame(const std::vector<FrameBufferPtr>& frameBuffers)
     {
-        auto image = fb.getImage();
-        auto fif = _params.format == "jpg"
-                ? FIF_JPEG
-                : FreeImage_GetFIFFromFormat(_params.format.c_str());
-
-        if (fif == FIF_JPEG)
-            image.reset(FreeImage_ConvertTo24Bits(image.get()));
-        else if (fif == FIF_UNKNOWN)
+        // keep the live scene from changing the models we share
+        auto lock = _scene->acquireRenderAccess();
+        if (_sharesModels && !_scene->sharesModels())
         {
-            std::cerr << "Unknown format: " << _params.format << std::endl;
-            return;
+            // the live scene gave us a copy of its models to change them
+            _sharesModels = false;
+            _scene->commit();
+            _renderer->commit();
+            for (auto frameBuffer : frameBuffers)
+                frameBuffer->clear();
         }
 
-        int flags = _params.quality;
-        if (fif == FIF_TIFF)
-            flags = TIFF_NONE;
-
-        brayns::freeimage::MemoryPtr memory(FreeImage_OpenMemory());
-
-        FreeImage_SaveToMemory(fif, image.get(), memory.get(), flags);
-
-        BYTE* pixels = nullptr;
-        DWORD numPixels = 0;
-        FreeImage_AcquireMemory(memory.get(), &pixels, &numPixels);
+        bool converged = true;
+        for (auto frameBuffer : frameBuffers)
+        {
+            _camera->setBufferTarget(frameBuffer->getName());
+            _camera->markModified(false);
+            _camera->commit();
+            _camera->resetModified();
+            _renderer->render(frameBuffer);
+            frameBuffer->incrementAccumFrames();
+            converged = converged && _renderer->hasConverged(*frameBuffer);
+        }
+        return converged;
+    }
 
-        std::ofstream file;
-        const std::string path = _params.filePath + "." + _params.format;
-        file.open(path, std::ios_base::binary);
-        if (!file.is_open())
+    /**
+     * Render the image tile by tile using camera image regions, so only the
+     * frame buffer of one tile is needed. Each row of tiles is written to the
+     * TIFF file as one strip. If the live scene changes its shared models
+     * meanwhile, the remaining tiles show the changed models.
+     */
+    void _renderTiles(const std::string& msg)
+    {
+        const auto& size = _params.size;
+        const auto tileSize = _params.tileSize;
+        const size_t rowSize = size_t(size.x) * 4;
+        const size_t numTiles = size_t((size.x + tileSize - 1) / tileSize) *
+                                ((size.y + tileSize - 1) / tileSize);
+
+        const auto path = _params.filePath + "." + _params.format;
+        TiffStripWriter tiffWriter(path, size, tileSize);
+        std::vector<uint8_t> strip(rowSize * tileSize);
+
+        auto frameBuffer =
+            _engine.createFrameBuffer("default", {tileSize, tileSize},
+                                      FrameBufferFormat::rgba_i8);
+
+        size_t tile = 0;
+        // rows of tiles from top to bottom
+        for (uint32_t y = 0; y < size.y; y += tileSize)
         {
-            std::cerr << "Failed to create " << path << std::endl;
-            return;
+            const auto tileHeight = std::min(tileSize, size.y - y);
+            for (uint32_t x = 0; x < size.x; x += tileSize, ++tile)
+            {
+                const auto tileWidth = std::min(tileSize, size.x - x);
+                const Vector2ui tileDims{tileWidth, tileHeight};
+                if (frameBuffer->getSize() != tileDims)
+                    frameBuffer->resize(tileDims);
+                frameBuffer->clear();
+
+                // image regions have their origin at the bottom left
+                const Vector2f regionStart{float(x) / size.x,
+                                           float(size.y - y - tileHeight) /
+                                               size.y};
+                const Vector2f regionEnd{float(x + tileWidth) / size.x,
+                                         float(size.y - y) / size.y};
+                _camera->setImageRegion(regionStart, regionEnd);
+
+                // tiles with little detail converge early and stop
+                bool converged = false;
+                while (!converged && frameBuffer->numAccumFrames() !=
+                                         size_t(_params.samplesPerPixel))
+                {
+                    converged = _renderFrame({frameBuffer});
+                    progress(msg, 1.f / (numTiles * _params.samplesPerPixel),
+                             (tile + float(frameBuffer->numAccumFrames()) /
+                                         _params.samplesPerPixel) /
+                                 numTiles);
+                }
+
+                // frame buffer rows are bottom-up, strip rows top-down
+                frameBuffer->map();
+                const auto colors = frameBuffer->getColorBuffer();
+                const size_t tileRowSize = size_t(tileWidth) * 4;
+                for (uint32_t row = 0; row < tileHeight; ++row)
+                    memcpy(strip.data() + row * rowSize + x * 4,
+                           colors + (tileHeight - 1 - row) * tileRowSize,
+                           tileRowSize);
+                frameBuffer->unmap();
+            }
+
+            tiffWriter.writeStrip(strip.data(), tileHeight);
         }
 
-        file.write((char*)pixels, numPixels);
-        file.close();
+        tiffWriter.finish();
+        if (_written)
+            _written(path, true);
+    }
+
+    void _writeToDisk(freeimage::ImagePtr image, const std::string& path)
+    {
+        _imageWriter.write(std::move(image), _params.format, _params.quality,
+                           path, _written);
     }
 
     SnapshotParams _params;
@@ -220,7 +353,10 @@ private:
     CameraPtr _camera;
     RendererPtr _renderer;
     ScenePtr _scene;
+    bool _sharesModels{false};
     ImageGenerator& _imageGenerator;
+    AsyncImageWriter& _imageWriter;
+    AsyncImageWriter::WrittenCallback _written;
     Engine& _engine;
 };
 } // namespace brayns
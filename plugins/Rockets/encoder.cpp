@@ -32,11 +32,13 @@ int custom_io_write(void *opaque, uint8_t *buffer, int32_t buffer_size)
 namespace brayns
 {
 Encoder::Encoder(const int width_, const int height_, const int fps,
-                 const int64_t kbps_, const DataFunc &dataFunc)
+                 const int64_t kbps_, const DataFunc &dataFunc,
+                 const bool accumulateWhileEncoding_)
     : _dataFunc(dataFunc)
     , width(width_)
     , height(height_)
     , kbps(kbps_)
+    , accumulateWhileEncoding(accumulateWhileEncoding_)
     , _fps(fps)
 {
 #ifndef FF_API_NEXT
@@ -110,6 +112,7 @@ Encoder::Encoder(const int width_, const int height_, const int fps,
         _thread = std::thread(std::bind(&Encoder::_runAsync, this));
 
     _timer.start();
+    _encoderFPSTimer.start();
 }
 
 Encoder::~Encoder()
@@ -117,8 +120,7 @@ Encoder::~Encoder()
     if (_async)
     {
         _running = false;
-        _queue.clear();
-        _queue.push(-1);
+        _mailbox.close();
         _thread.join();
     }
 
@@ -131,43 +133,52 @@ Encoder::~Encoder()
     }
 }
 
-void Encoder::encode(FrameBuffer &fb)
+bool Encoder::encode(FrameBuffer &fb, const bool force)
 {
-    if (_async && _queue.size() == 2)
-        return;
+    if (_async && accumulateWhileEncoding && !force &&
+        (_encoding || _mailbox.hasPending()))
+    {
+        return false;
+    }
 
     fb.map();
     auto cdata = reinterpret_cast<const uint8_t *const>(fb.getColorBuffer());
     if (_async)
     {
-        auto &image = _image[_currentImage];
-        image.width = fb.getSize().x;
-        image.height = fb.getSize().y;
-        const auto bufferSize = image.width * image.height * fb.getColorDepth();
-
-        if (image.data.size() < bufferSize)
-            image.data.resize(bufferSize);
-        memcpy(image.data.data(), cdata, bufferSize);
-        _queue.push(_currentImage);
-        _currentImage = _currentImage == 0 ? 1 : 0;
+        _image.width = fb.getSize().x;
+        _image.height = fb.getSize().y;
+        _image.force = force;
+        const size_t bufferSize =
+            _image.width * _image.height * fb.getColorDepth();
+
+        if (_image.data.size() < bufferSize)
+            _image.data.resize(bufferSize);
+        memcpy(_image.data.data(), cdata, bufferSize);
         fb.unmap();
-        return;
+
+        // never blocks; a frame the encoder did not pick up yet is dropped
+        _mailbox.put(_image);
+        return true;
     }
 
     _toPicture(cdata, fb.getSize().x, fb.getSize().y);
     fb.unmap();
 
-    _encode();
+    _encode(force);
+    return true;
 }
 
-void Encoder::_encode()
+void Encoder::_encode(const bool force)
 {
     const auto elapsed = _timer.elapsed() + _leftover;
     const auto duration = 1.0 / _fps;
-    if (elapsed < duration)
+    if (elapsed < duration && !force)
+    {
+        ++_pacedFrames;
         return;
+    }
 
-    _leftover = elapsed - duration;
+    _leftover = std::max(0.0, elapsed - duration);
     for (; _leftover > duration;)
         _leftover -= duration;
 
@@ -190,20 +201,24 @@ void Encoder::_encode()
     av_interleaved_write_frame(formatContext, &pkt);
 
     _timer.start();
+
+    _encoderFPSTimer.stop();
+    _encoderFPS = _encoderFPSTimer.perSecondSmoothed();
+    _encoderFPSTimer.start();
 }
 
 void Encoder::_runAsync()
 {
+    Image image;
     while (_running)
     {
-        auto idx = _queue.pop();
-        if (idx < 0)
+        if (!_mailbox.take(image))
             break;
 
-        auto &image = _image[idx];
-
+        _encoding = true;
         _toPicture(image.data.data(), image.width, image.height);
-        _encode();
+        _encode(image.force);
+        _encoding = false;
     }
 }
 
@@ -33,7 +33,6 @@ extern "C" {
 #include <condition_variable>
 #include <functional>
 #include <mutex>
-#include <queue>
 #include <thread>
 
 namespace brayns
@@ -59,51 +58,76 @@ public:
     }
 };
 
-template <typename T, size_t S = 2>
-class MTQueue
+/**
+ * Single-slot mailbox between a producer and a consumer thread with
+ * latest-frame-wins semantics: putting an element while the previous one was
+ * not taken yet replaces (drops) the stale one, so the producer never waits for
+ * the consumer. Elements are swapped in and out to recycle their buffers.
+ */
+template <typename T>
+class LatestFrameMailbox
 {
 public:
-    explicit MTQueue(const size_t maxSize = S)
-        : _maxSize(maxSize)
+    /**
+     * Hand over element to the consumer. On return, element holds the buffer
+     * of the replaced element (if any) for reuse by the producer.
+     * @return true if a pending element was dropped
+     */
+    bool put(T &element)
     {
+        std::unique_lock<std::mutex> lock(_mutex);
+        const bool dropped = _hasElement;
+        if (dropped)
+            ++_droppedCount;
+        std::swap(_element, element);
+        _hasElement = true;
+        _condition.notify_all();
+        return dropped;
     }
 
-    void clear()
+    /**
+     * Wait for the latest element and swap it into element.
+     * @return false if the mailbox was closed
+     */
+    bool take(T &element)
     {
         std::unique_lock<std::mutex> lock(_mutex);
-        std::queue<T>().swap(_queue);
-        _condition.notify_all();
+        _condition.wait(lock, [&] { return _hasElement || _closed; });
+        if (_closed)
+            return false;
+        std::swap(_element, element);
+        _hasElement = false;
+        return true;
     }
 
-    void push(const T &element)
+    /** Wake up and release a waiting consumer; subsequent takes fail. */
+    void close()
     {
         std::unique_lock<std::mutex> lock(_mutex);
-        _condition.wait(lock, [&] { return _queue.size() < _maxSize; });
-        _queue.push(element);
+        _closed = true;
         _condition.notify_all();
     }
 
-    T pop()
+    bool hasPending() const
     {
         std::unique_lock<std::mutex> lock(_mutex);
-        _condition.wait(lock, [&] { return !_queue.empty(); });
-
-        T element = _queue.front();
-        _queue.pop();
-        _condition.notify_all();
-        return element;
+        return _hasElement;
     }
-    size_t size() const
+
+    /** @return the number of elements replaced before they were taken */
+    size_t getDroppedCount() const
     {
         std::unique_lock<std::mutex> lock(_mutex);
-        return _queue.size();
+        return _droppedCount;
     }
 
 private:
-    std::queue<T> _queue;
+    T _element;
+    bool _hasElement{false};
+    bool _closed{false};
+    size_t _droppedCount{0};
     mutable std::mutex _mutex;
-    mutable std::condition_variable _condition;
-    const size_t _maxSize;
+    std::condition_variable _condition;
 };
 
 class Encoder
@@ -112,15 +136,40 @@ public:
     using DataFunc = std::function<void(const char *data, size_t size)>;
 
     Encoder(const int width, const int height, const int fps,
-            const int64_t kbps, const DataFunc &dataFunc);
+            const int64_t kbps, const DataFunc &dataFunc,
+            const bool accumulateWhileEncoding = false);
     ~Encoder();
 
-    void encode(FrameBuffer &fb);
+    /**
+     * Hand the current content of the framebuffer over to the encoder thread,
+     * replacing a frame that is still waiting to be encoded.
+     *
+     * If accumulateWhileEncoding is set, the framebuffer is not even mapped
+     * while the encoder is still busy, so the renderer can keep accumulating
+     * until the encoder catches up; force overrides this, e.g. for the last
+     * frame of an accumulation.
+     *
+     * @return false if the frame was skipped
+     */
+    bool encode(FrameBuffer &fb, bool force = false);
+
+    /** @return the rate of frames written to the stream */
+    double getEncoderFPS() const { return _encoderFPS; }
+
+    /**
+     * @return the number of rendered frames dropped because of a slow encoder
+     * or because they exceeded the stream fps
+     */
+    size_t getDroppedFrames() const
+    {
+        return _mailbox.getDroppedCount() + _pacedFrames;
+    }
 
     DataFunc _dataFunc;
     const int width;
     const int height;
     const int64_t kbps;
+    const bool accumulateWhileEncoding;
 
 private:
     const int _fps;
@@ -138,25 +187,32 @@ private:
     const bool _async = true;
     std::thread _thread;
     std::atomic_bool _running{true};
+    std::atomic_bool _encoding{false};
 
     struct Image
     {
         int width{0};
         int height{0};
+        bool force{false};
         std::vector<uint8_t> data;
         bool empty() const { return width == 0 || height == 0; }
         void clear() { width = height = 0; }
-    } _image[2];
+    };
 
-    MTQueue<int> _queue;
-    int _currentImage{0};
+    // written by the render side, swapped with the mailbox slot on put()
+    Image _image;
+    LatestFrameMailbox<Image> _mailbox;
 
     void _runAsync();
-    void _encode();
+    void _encode(bool force);
     void _toPicture(const uint8_t *const data, const int width,
                     const int height);
 
     Timer _timer;
     float _leftover{0.f};
+    std::atomic_size_t _pacedFrames{0};
+
+    Timer _encoderFPSTimer;
+    std::atomic<double> _encoderFPS{0.0};
 };
 }
@@ -42,6 +42,7 @@
 #include <brayns/tasks/errors.h>
 #include <brayns/version.h>
 
+#include "ExportFramesTask.h"
 #include "ImageGenerator.h"
 #include "SnapshotTask.h"
 
@@ -60,6 +61,13 @@ struct SchemaParam
     std::string endpoint;
 };
 
+/** Notification for each file of a snapshot once it is written or failed. */
+struct SnapshotFile
+{
+    std::string path;
+    bool written{false};
+};
+
 struct EnvironmentMapParam
 {
     std::string filename;
@@ -69,10 +77,12 @@ struct VideoStreamParam
 {
     bool enabled{false};
     uint32_t kbps{5000};
+    bool accumulateWhileEncoding{false};
 
     bool operator==(const VideoStreamParam& rhs) const
     {
-        return enabled == rhs.enabled && kbps == rhs.kbps;
+        return enabled == rhs.enabled && kbps == rhs.kbps &&
+               accumulateWhileEncoding == rhs.accumulateWhileEncoding;
     }
 
     bool operator!=(const VideoStreamParam& rhs) const
@@ -154,6 +164,13 @@ struct DirectoryFileList
 struct ImageStreamingMethod
 {
     std::string type;
+    bool framed{false};
+    uint32_t maxPendingFrames{0};
+};
+
+struct ImageAck
+{
+    size_t frameID{0};
 };
 
 struct ExitLaterSchedule
@@ -254,6 +271,13 @@ inline void init(brayns::SchemaParam* s, ObjectHandler* h)
     h->set_flags(Flags::DisallowUnknownKey);
 }
 
+inline void init(brayns::SnapshotFile* s, ObjectHandler* h)
+{
+    h->add_property("path", &s->path);
+    h->add_property("written", &s->written);
+    h->set_flags(Flags::DisallowUnknownKey);
+}
+
 inline void init(brayns::EnvironmentMapParam* s, ObjectHandler* h)
 {
     h->add_property("filename", &s->filename);
@@ -264,12 +288,15 @@ inline void init(brayns::VideoStreamParam* s, ObjectHandler* h)
 {
     h->add_property("enabled", &s->enabled, Flags::Optional);
     h->add_property("kbps", &s->kbps, Flags::Optional);
+    h->add_property("accumulate_while_encoding", &s->accumulateWhileEncoding,
+                    Flags::Optional);
     h->set_flags(Flags::DisallowUnknownKey);
 }
 
 inline void init(brayns::Chunk* c, ObjectHandler* h)
 {
     h->add_property("id", &c->id, Flags::Optional);
+    h->add_property("attachment", &c->attachment, Flags::Optional);
     h->set_flags(Flags::DisallowUnknownKey);
 }
 
@@ -300,13 +327,53 @@ inline void init(brayns::SnapshotParams* s, ObjectHandler* h)
     h->add_property("samples_per_pixel", &s->samplesPerPixel, Flags::Optional);
     h->add_property("size", toArray<2, uint32_t>(s->size));
     h->add_property("filePath", &s->filePath, Flags::Optional);
+    h->add_property("tile_size", &s->tileSize, Flags::Optional);
+    h->add_property("hdr", &s->hdr, Flags::Optional);
+    h->add_property("depth", &s->depth, Flags::Optional);
+    h->set_flags(Flags::DisallowUnknownKey);
+}
+
+inline void init(brayns::CameraKeyframe* c, ObjectHandler* h)
+{
+    h->add_property("orientation", toArray(c->orientation));
+    h->add_property("position", toArray<3, double>(c->position));
+    h->add_property("target", toArray<3, double>(c->target), Flags::Optional);
+    h->set_flags(Flags::DisallowUnknownKey);
+}
+
+inline void init(brayns::ExportFramesParams* s, ObjectHandler* h)
+{
+    h->add_property("path", &s->path);
+    h->add_property("format", &s->format, Flags::Optional);
+    h->add_property("quality", &s->quality, Flags::Optional);
+    h->add_property("samples_per_pixel", &s->samplesPerPixel, Flags::Optional);
+    h->add_property("size", toArray<2, uint32_t>(s->size));
+    h->add_property("cameras", &s->cameras, Flags::Optional);
+    h->add_property("animation_frames", &s->animationFrames, Flags::Optional);
+    h->add_property("start_frame", &s->startFrame, Flags::Optional);
+    h->add_property("resume", &s->resume, Flags::Optional);
+    h->set_flags(Flags::DisallowUnknownKey);
+}
+
+inline void init(brayns::ExportFramesResult* s, ObjectHandler* h)
+{
+    h->add_property("frames_written", &s->framesWritten);
+    h->add_property("frames_skipped", &s->framesSkipped);
     h->set_flags(Flags::DisallowUnknownKey);
 }
 
 inline void init(brayns::Statistics* s, ObjectHandler* h)
 {
     h->add_property("fps", &s->_fps);
+    h->add_property("encoder_fps", &s->_encoderFPS, Flags::Optional);
+    h->add_property("dropped_frames", &s->_droppedFrames, Flags::Optional);
     h->add_property("scene_size_in_bytes", &s->_sceneSizeInBytes);
+    h->add_property("simulation_cache_hits", &s->_simulationCacheHits,
+                    Flags::Optional);
+    h->add_property("simulation_cache_misses", &s->_simulationCacheMisses,
+                    Flags::Optional);
+    h->add_property("simulation_stalls", &s->_simulationStalls,
+                    Flags::Optional);
     h->set_flags(Flags::DisallowUnknownKey);
 }
 
@@ -457,6 +524,8 @@ inline void init(brayns::RenderingParameters* r, ObjectHandler* h)
     h->add_property("max_accum_frames", &r->_maxAccumFrames, Flags::Optional);
     h->add_property("samples_per_pixel", &r->_spp, Flags::Optional);
     h->add_property("subsampling", &r->_subsampling, Flags::Optional);
+    h->add_property("target_frame_time", &r->_targetFrameTime,
+                    Flags::Optional);
     h->add_property("types", &r->_renderers,
                     Flags::IgnoreRead | Flags::Optional);
     h->add_property("variance_threshold", &r->_varianceThreshold,
@@ -494,6 +563,7 @@ inline void init(brayns::AnimationParameters* a, ObjectHandler* h)
     h->add_property("delta", &a->_delta, Flags::Optional);
     h->add_property("dt", &a->_dt, Flags::Optional);
     h->add_property("playing", &a->_playing, Flags::Optional);
+    h->add_property("prefetch_frames", &a->_prefetchFrames, Flags::Optional);
     h->add_property("unit", &a->_unit, Flags::Optional);
     h->set_flags(Flags::DisallowUnknownKey);
 }
@@ -610,6 +680,15 @@ inline void init(brayns::DirectoryFileList* a, ObjectHandler* h)
 inline void init(brayns::ImageStreamingMethod* a, ObjectHandler* h)
 {
     h->add_property("type", &a->type);
+    h->add_property("framed", &a->framed, Flags::Optional);
+    h->add_property("max_pending_frames", &a->maxPendingFrames,
+                    Flags::Optional);
+    h->set_flags(Flags::DisallowUnknownKey);
+}
+
+inline void init(brayns::ImageAck* a, ObjectHandler* h)
+{
+    h->add_property("frame_id", &a->frameID);
     h->set_flags(Flags::DisallowUnknownKey);
 }
 
@@ -24,12 +24,33 @@
 
 """Client that connects to a remote running Brayns instance which provides the supported API."""
 
+from contextlib import contextmanager
+
 import rockets
 
 from .base import BaseClient
 from .utils import build_schema_requests_from_registry, convert_snapshot_response_to_PIL
 
 
+class _BatchRecorder:
+    """Stands in for the rockets client to record calls instead of sending them."""
+
+    def __init__(self):
+        self.calls = list()
+
+    def request(self, method, params=None, response_timeout=None):  # pylint: disable=W0613
+        """Record a request."""
+        self.calls.append(rockets.Request(method, params))
+
+    def notify(self, method, params=None):
+        """Record a notification."""
+        self.calls.append(rockets.Notification(method, params))
+
+    def send(self, data):  # pylint: disable=W0613,R0201
+        """Binary attachments are separate websocket messages and cannot be part of a batch."""
+        raise RuntimeError('Binary attachments cannot be sent within a batch')
+
+
 class Client(BaseClient):
     """Client that connects to a remote running Brayns instance which provides the supported API."""
 
@@ -68,3 +89,41 @@ class Client(BaseClient):
         del args['self']
         result = self.snapshot(**{k: v for k, v in args.items() if v})
         return convert_snapshot_response_to_PIL(result)
+
+    @contextmanager
+    def batch(self, response_timeout=None):
+        """
+        Collect all method calls within the context and send them as one JSON-RPC batch on exit.
+
+        Brayns processes the batch as a single message, so all calls are applied within the same
+        frame and answered with one response, which avoids a round-trip per call. Calls of plugin
+        wrappers, e.g. CircuitExplorer.set_material(), are batched as well.
+        Property commits, e.g. camera.commit(), and binary attachments are not part of the batch.
+
+        :param int response_timeout: number of seconds to wait for the batch response
+        :return: list which receives the results of the requests in call order after the context
+                 exits; failed requests are represented by their error object
+        :rtype: list
+        """
+        recorder = _BatchRecorder()
+        results = list()
+        rockets_client = self.rockets_client
+        self.rockets_client = recorder
+        try:
+            yield results
+        finally:
+            self.rockets_client = rockets_client
+
+        if not recorder.calls:
+            return
+
+        responses = rockets_client.batch(recorder.calls, response_timeout)
+        # pylint: disable=protected-access
+        responses_by_id = {response._id: response for response in responses}
+        for call in recorder.calls:
+            if isinstance(call, rockets.Request):
+                response = responses_by_id.get(call.request_id())
+                if response is None:
+                    results.append(None)
+                else:
+                    results.append(response.error if response.error else response.result)
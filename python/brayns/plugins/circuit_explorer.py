@@ -80,7 +80,12 @@ class CircuitExplorer:
 
     def __init__(self, client):
         """Create a new Circuit Explorer instance"""
-        self._client = client.rockets_client
+        self._brayns = client
+
+    @property
+    def _client(self):
+        """The rockets client of the Brayns client, which is swapped while it records a batch"""
+        return self._brayns.rockets_client
 
     # pylint: disable=W0102,R0913,R0914
     def load_circuit(self, path, name='Circuit', density=100.0, gids=list(),
@@ -22,6 +22,11 @@
 
 """Provides a class that wraps the API exposed by the braynsDTI plug-in"""
 
+import array
+import struct
+
+from ..utils import notify_with_attachment
+
 
 class DiffuseTensorImaging:
     """DiffuseTensorImaging is a class that wraps the API exposed by the braynsDTI plug-in"""
@@ -32,10 +37,15 @@ class DiffuseTensorImaging:
 
     def __init__(self, client):
         """Create a new Diffuse Tensor Imaging instance"""
-        self._client = client.rockets_client
+        self._brayns = client
+
+    @property
+    def _client(self):
+        """The rockets client of the Brayns client, which is swapped while it records a batch"""
+        return self._brayns.rockets_client
 
     def add_streamlines(self, name, streamlines, radius=1.0, opacity=1.0, color_scheme=COLOR_SCHEME_DIRECTIONAL,
-                        start_model_id=-1, end_model_id=-1):
+                        start_model_id=-1, end_model_id=-1, binary=False):
         """
         Adds streamlines to the scene. All streamlines are added to a single model
 
@@ -43,7 +53,9 @@ class DiffuseTensorImaging:
         :param float streamlines: Streamlines
         :param float radius: Radius of the streamlines
         :param float opacity: Opacity of the streamlines
-        :return: Result of the request submission
+        :param bool binary: Send indices and vertices as a binary attachment instead of JSON
+        arrays, which is much faster for large sets of streamlines
+        :return: Result of the request submission, None if sent as binary
         :rtype: str
         """
         count = 0
@@ -59,11 +71,21 @@ class DiffuseTensorImaging:
         params = dict()
         params['name'] = name
         params['gids'] = list()  # Not used
-        params['indices'] = indices
-        params['vertices'] = vertices
         params['radius'] = radius
         params['opacity'] = opacity
         params['colorScheme'] = color_scheme
         params['startModelId'] = start_model_id
         params['endModelId'] = end_model_id
+
+        if binary:
+            params['indices'] = list()
+            params['vertices'] = list()
+            data = struct.pack('<QQQ', 0, len(indices), len(vertices))
+            data += array.array('Q', indices).tobytes()
+            data += array.array('f', vertices).tobytes()
+            notify_with_attachment(self._client, 'add-streamlines', params, data)
+            return None
+
+        params['indices'] = indices
+        params['vertices'] = vertices
         return self._client.request("add-streamlines", params=params)
@@ -27,6 +27,7 @@
 import base64
 import io
 import sys
+import uuid
 from collections import OrderedDict
 from functools import wraps
 from PIL import Image
@@ -229,6 +230,26 @@ def build_schema_requests_from_registry(url):
     return registry, request_list
 
 
+def notify_with_attachment(rockets_client, method, params, data):
+    """
+    Send a notification whose bulk numeric data is attached as binary instead of JSON arrays.
+
+    The attachment is announced by a 'chunk' notification, sent as a binary websocket message and
+    referenced by the 'chunks_id' member of the notification parameters.
+
+    :param rockets.Client rockets_client: the client to send with
+    :param str method: name of the notification
+    :param dict params: parameters of the notification
+    :param bytes data: the binary attachment, e.g. the bytes of typed arrays
+    """
+    chunks_id = str(uuid.uuid4())
+    rockets_client.notify('chunk', {'id': chunks_id, 'attachment': True})
+    rockets_client.send(bytes(data))
+    params = dict(params)
+    params['chunks_id'] = chunks_id
+    rockets_client.notify(method, params)
+
+
 def convert_snapshot_response_to_PIL(response):
     """Convert the snapshot response from Brayns to a PIL image"""
     if not response:  # pragma: no cover
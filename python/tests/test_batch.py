@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# Copyright (c) 2016-2018, Blue Brain Project
+#                          Raphael Dumusc <raphael.dumusc@epfl.ch>
+#                          Daniel Nachbaur <daniel.nachbaur@epfl.ch>
+#                          Cyrille Favreau <cyrille.favreau@epfl.ch>
+#
+# This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+#
+# This library is free software; you can redistribute it and/or modify it under
+# the terms of the GNU Lesser General Public License version 3.0 as published
+# by the Free Software Foundation.
+#
+# This library is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+# details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library; if not, write to the Free Software Foundation, Inc.,
+# 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+# All rights reserved. Do not distribute without further notice.
+
+import brayns
+import rockets
+from brayns.plugins.circuit_explorer import CircuitExplorer
+
+from nose.tools import assert_equal
+from mock import patch
+from .mocks import *
+
+
+sent_batches = list()
+
+
+def mock_batch_with_calls(self, requests, response_timeout=None):
+    if requests[0].method == 'schema':
+        return mock_batch(self, requests, response_timeout)
+
+    sent_batches.append(requests)
+    results = list()
+    for request in requests:
+        if isinstance(request, rockets.Request):
+            results.append(rockets.Response(result=mock_rpc_request(self, request.method,
+                                                                    request.params),
+                                            _id=request.request_id()))
+    return results
+
+
+def mock_no_call(self, method, params=None, response_timeout=None):
+    raise AssertionError('Call must be batched')
+
+
+def test_batch():
+    with patch('rockets.AsyncClient.connected', new=mock_connected), \
+         patch('brayns.utils.http_request', new=mock_http_request), \
+         patch('rockets.Client.batch', new=mock_batch_with_calls), \
+         patch('rockets.Client.request', new=mock_no_call), \
+         patch('rockets.Client.notify', new=mock_no_call):
+        app = brayns.Client('localhost:8200')
+        del sent_batches[:]
+        with app.batch() as results:
+            app.test_request_single_arg(doit=True, name='foo')
+            app.test_notify_single_arg(doit=True, name='bar')
+            app.test_request_single_arg(doit=False, name='foo')
+            assert_equal(results, [])
+
+        assert_equal(len(sent_batches), 1)
+        assert_equal(len(sent_batches[0]), 3)
+        assert_equal(results, ['foo', None])
+
+
+def test_batch_plugin_calls():
+    with patch('rockets.AsyncClient.connected', new=mock_connected), \
+         patch('brayns.utils.http_request', new=mock_http_request), \
+         patch('rockets.Client.batch', new=mock_batch_with_calls), \
+         patch('rockets.Client.request', new=mock_no_call), \
+         patch('rockets.Client.notify', new=mock_no_call):
+        app = brayns.Client('localhost:8200')
+        ce = CircuitExplorer(app)
+        del sent_batches[:]
+        with app.batch() as results:
+            for material_id in range(3):
+                ce.set_material(model_id=0, material_id=material_id,
+                                diffuse_color=(1, 0, 0), specular_color=(1, 1, 1))
+
+        assert_equal(len(sent_batches), 1)
+        assert_equal([call.method for call in sent_batches[0]], ['set-material'] * 3)
+        assert_equal([call.params['materialId'] for call in sent_batches[0]], [0, 1, 2])
+        assert_equal(len(results), 3)
+
+
+def test_batch_rejects_attachments():
+    with patch('rockets.AsyncClient.connected', new=mock_connected), \
+         patch('brayns.utils.http_request', new=mock_http_request), \
+         patch('rockets.Client.batch', new=mock_batch_with_calls):
+        app = brayns.Client('localhost:8200')
+        raised = False
+        with app.batch():
+            try:
+                brayns.utils.notify_with_attachment(app.rockets_client, 'test', dict(), b'')
+            except RuntimeError:
+                raised = True
+        assert_equal(raised, True)
+
+
+def test_empty_batch():
+    with patch('rockets.AsyncClient.connected', new=mock_connected), \
+         patch('brayns.utils.http_request', new=mock_http_request), \
+         patch('rockets.Client.batch', new=mock_batch):
+        app = brayns.Client('localhost:8200')
+        with app.batch() as results:
+            pass
+        assert_equal(results, [])
@@ -50,6 +50,45 @@ def test_add_streamline():
         assert_equal(response, {'ok'})
 
 
+def test_add_streamline_binary():
+    streamlines = [
+        [
+            [0, 0, 0], [1, 1, 1], [2, 2, 2]
+        ]
+    ]
+    notifications = list()
+    sent = list()
+
+    def mock_notify(self, method, params=None):
+        notifications.append((method, params))
+
+    def mock_send(self, message):
+        sent.append(message)
+
+    with patch('rockets.AsyncClient.connected', new=mock_connected), \
+         patch('brayns.utils.http_request', new=mock_http_request), \
+         patch('brayns.utils.in_notebook', new=mock_not_in_notebook), \
+         patch('rockets.Client.notify', new=mock_notify), \
+         patch('rockets.Client.send', new=mock_send), \
+         patch('rockets.Client.batch', new=mock_batch):
+        app = brayns.Client('localhost:8200')
+        dti = DiffuseTensorImaging(app)
+        response = dti.add_streamlines(name='dti', streamlines=streamlines, binary=True)
+        assert_equal(response, None)
+
+    assert_equal(len(notifications), 2)
+    chunk_method, chunk = notifications[0]
+    method, params = notifications[1]
+    assert_equal(chunk_method, 'chunk')
+    assert_equal(chunk['attachment'], True)
+    assert_equal(method, 'add-streamlines')
+    assert_equal(params['chunks_id'], chunk['id'])
+    assert_equal(params['vertices'], [])
+    assert_equal(len(sent), 1)
+    # header of 3 counts, 1 index, 9 vertex components
+    assert_equal(len(sent[0]), 3 * 8 + 8 + 9 * 4)
+
+
 if __name__ == '__main__':
     import nose
     nose.run(defaultTest=__name__)
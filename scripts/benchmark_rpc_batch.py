@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+"""
+Compare the time of many set-material calls sent one by one against sending
+them as one batch to a running Brayns instance with the CircuitExplorer plugin.
+
+The materials of the given model are updated in turn until the number of calls
+is reached.
+
+Usage: benchmark_rpc_batch.py [host:port] [model id] [number of calls]
+"""
+import sys
+import time
+
+import brayns
+from brayns.plugins.circuit_explorer import CircuitExplorer
+
+url = sys.argv[1] if len(sys.argv) > 1 else "localhost:8200"
+model_id = int(sys.argv[2]) if len(sys.argv) > 2 else 0
+count = int(sys.argv[3]) if len(sys.argv) > 3 else 10000
+
+client = brayns.Client(url)
+circuit_explorer = CircuitExplorer(client)
+material_ids = circuit_explorer.get_material_ids(model_id)["ids"]
+if not material_ids:
+    sys.exit("Model {} has no materials".format(model_id))
+colors = [((i % 100) / 100.0, (i // 100 % 100) / 100.0, 0.5) for i in range(count)]
+
+
+def set_materials():
+    for i, color in enumerate(colors):
+        circuit_explorer.set_material(
+            model_id=model_id, material_id=material_ids[i % len(material_ids)],
+            diffuse_color=color, specular_color=(1, 1, 1))
+
+
+start = time.time()
+set_materials()
+unbatched = time.time() - start
+
+start = time.time()
+with client.batch() as results:
+    set_materials()
+batched = time.time() - start
+
+assert len(results) == count
+print("{} set-material calls unbatched: {:.3f}s, batched: {:.3f}s, speedup: {:.1f}x".format(
+    count, unbatched, batched, unbatched / batched))
@@ -0,0 +1,102 @@
+#pragma once
+
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "doctest.h"
+
+#include <brayns/common/simulation/AbstractSimulationHandler.h>
+
+#include <brion/compartmentReport.h>
+
+namespace stubReport
+{
+const std::string PATH = "/tmp/brayns_stub_report.h5";
+const brion::GIDSet GIDS{1, 2};
+const uint32_t NB_FRAMES = 5;
+const double DT = 0.5;
+const brion::uint16_ts COMPARTMENTS{2, 1}; // per section of each cell
+const size_t FRAME_SIZE = 6;
+const uint64_t FRAME_BYTES = FRAME_SIZE * sizeof(float);
+
+/** Write a small report whose values are the number of their frame. */
+inline void write()
+{
+    brion::CompartmentReport report(brion::URI(PATH), brion::MODE_OVERWRITE,
+                                    GIDS);
+    report.writeHeader(0, NB_FRAMES * DT, DT, "mV", "ms");
+    for (const auto gid : GIDS)
+        report.writeCompartments(gid, COMPARTMENTS);
+    for (uint32_t frame = 0; frame < NB_FRAMES; ++frame)
+        for (const auto gid : GIDS)
+            report.writeFrame(gid, brion::floats(3, float(frame)), frame * DT);
+    report.flush();
+}
+
+/** @return the first value of the frame, which is the frame number. */
+inline float frameValue(brayns::AbstractSimulationHandler& handler,
+                        const uint32_t frame)
+{
+    const auto data = static_cast<const float*>(handler.getFrameData(frame));
+    REQUIRE(data);
+    return data[0];
+}
+
+/**
+ * Go through the frames of a synchronous handler with a frame cache of two
+ * frames: misses are loaded from the report into the cache, hits are read
+ * from the cache, and loading a frame into a full cache evicts the least
+ * recently used frame.
+ */
+inline void checkFrameCache(brayns::AbstractSimulationHandler& handler)
+{
+    CHECK_EQ(handler.getNbFrames(), NB_FRAMES);
+    CHECK_EQ(handler.getFrameSize(), FRAME_SIZE);
+
+    CHECK_EQ(frameValue(handler, 0), 0.f);
+    CHECK_EQ(frameValue(handler, 1), 1.f);
+    auto counters = handler.getFrameCacheCounters();
+    CHECK_EQ(counters.hits, 0);
+    CHECK_EQ(counters.misses, 2);
+    CHECK_EQ(counters.evictions, 0);
+
+    CHECK_EQ(frameValue(handler, 0), 0.f);
+    counters = handler.getFrameCacheCounters();
+    CHECK_EQ(counters.hits, 1);
+    CHECK_EQ(counters.misses, 2);
+
+    // frame 1 is the least recently used one
+    CHECK_EQ(frameValue(handler, 2), 2.f);
+    counters = handler.getFrameCacheCounters();
+    CHECK_EQ(counters.misses, 3);
+    CHECK_EQ(counters.evictions, 1);
+
+    CHECK_EQ(frameValue(handler, 0), 0.f);
+    CHECK_EQ(frameValue(handler, 1), 1.f);
+    counters = handler.getFrameCacheCounters();
+    CHECK_EQ(counters.hits, 2);
+    CHECK_EQ(counters.misses, 4);
+    CHECK_EQ(counters.evictions, 2);
+
+    // the current frame is neither read from the cache nor loaded again
+    CHECK_EQ(frameValue(handler, 1), 1.f);
+    CHECK_EQ(handler.getFrameCacheCounters().hits, 2);
+    CHECK_EQ(handler.getFrameCacheCounters().misses, 4);
+}
+} // namespace stubReport
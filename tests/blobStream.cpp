@@ -0,0 +1,180 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <brayns/common/loader/BlobStream.h>
+
+#include <async++.h>
+
+#include <atomic>
+#include <future>
+#include <istream>
+#include <thread>
+
+TEST_CASE("partial_reads")
+{
+    brayns::BlobStream stream("xyz", "test", 10, 100);
+    CHECK(stream.append("0123"));
+    CHECK(stream.append("456789"));
+
+    char data[6];
+    REQUIRE_EQ(stream.sgetn(data, 3), 3);
+    CHECK_EQ(std::string(data, 3), "012");
+    CHECK_EQ(stream.getReadBytes(), 3);
+
+    // reads span the received chunks
+    REQUIRE_EQ(stream.sgetn(data, 5), 5);
+    CHECK_EQ(std::string(data, 5), "34567");
+    CHECK_EQ(stream.getReadBytes(), 8);
+
+    const auto rest = stream.readAll();
+    REQUIRE_EQ(rest.size(), 2);
+    CHECK_EQ(rest[0], '8');
+    CHECK_EQ(rest[1], '9');
+}
+
+TEST_CASE("read_while_receiving")
+{
+    brayns::BlobStream stream("xyz", "test", 8, 100);
+    std::thread receiver([&stream] {
+        for (const auto& chunk : {"1 2", "\n3", " 4\n"})
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            stream.append(chunk);
+        }
+    });
+
+    std::istream in(&stream);
+    int value;
+    int sum = 0;
+    while (in >> value)
+        sum += value;
+    receiver.join();
+
+    CHECK_EQ(sum, 10);
+    CHECK(in.eof());
+}
+
+TEST_CASE("end_of_stream")
+{
+    brayns::BlobStream stream("xyz", "test", 4, 100);
+    CHECK(stream.append("abcd"));
+
+    char data[8];
+    CHECK_EQ(stream.sgetn(data, sizeof(data)), 4);
+    CHECK_EQ(stream.sgetc(), brayns::BlobStream::traits_type::eof());
+    CHECK(stream.readAll().empty());
+}
+
+TEST_CASE("wait_for_capacity")
+{
+    brayns::BlobStream stream("xyz", "test", 12, 8);
+    CHECK(stream.append("0123"));
+    CHECK(stream.append("4567"));
+
+    auto appended = std::async(std::launch::async,
+                               [&stream] { return stream.append("89ab"); });
+    CHECK(appended.wait_for(std::chrono::milliseconds(10)) ==
+          std::future_status::timeout);
+
+    // the capacity is released once the reader consumed the data
+    char data[4];
+    REQUIRE_EQ(stream.sgetn(data, sizeof(data)), 4);
+    CHECK(appended.get());
+    CHECK_EQ(stream.readAll().size(), 8);
+}
+
+TEST_CASE("slow_reader")
+{
+    const size_t chunkSize = 16;
+    const size_t numChunks = 64;
+    brayns::BlobStream stream("xyz", "test", chunkSize * numChunks,
+                              2 * chunkSize);
+    const auto chunk = [](const size_t i) {
+        return std::string(chunkSize, char('a' + i % 26));
+    };
+
+    std::atomic_size_t appended{0};
+    std::thread receiver([&] {
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            if (!stream.append(chunk(i)))
+                return;
+            ++appended;
+        }
+    });
+
+    char data[chunkSize];
+    size_t maxAhead = 0;
+    for (size_t i = 0; i < numChunks; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        // the read chunks and at most two buffered ones
+        maxAhead = std::max(maxAhead, appended - i);
+        REQUIRE_EQ(stream.sgetn(data, chunkSize), chunkSize);
+        CHECK_EQ(std::string(data, chunkSize), chunk(i));
+    }
+    receiver.join();
+
+    CHECK_EQ(appended, numChunks);
+    CHECK_LE(maxAhead, 2);
+    CHECK_EQ(stream.sgetc(), brayns::BlobStream::traits_type::eof());
+}
+
+TEST_CASE("big_chunk")
+{
+    // a chunk bigger than the capacity is taken once the buffer is empty
+    brayns::BlobStream stream("xyz", "test", 12, 4);
+    CHECK(stream.append("0123456789ab"));
+    CHECK_EQ(stream.readAll().size(), 12);
+}
+
+TEST_CASE("cancel")
+{
+    brayns::BlobStream stream("xyz", "test", 8, 100);
+    CHECK(stream.append("0123"));
+
+    char data[8];
+    std::thread canceller([&stream] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        stream.cancel();
+    });
+    // waits for the missing data until the stream is cancelled
+    CHECK_THROWS_AS(stream.sgetn(data, sizeof(data)), async::task_canceled);
+    canceller.join();
+
+    CHECK(!stream.append("4567"));
+    CHECK_THROWS_AS(stream.sgetc(), async::task_canceled);
+}
+
+TEST_CASE("cancel_waiting_receiver")
+{
+    brayns::BlobStream stream("xyz", "test", 8, 4);
+    CHECK(stream.append("0123"));
+
+    auto appended = std::async(std::launch::async,
+                               [&stream] { return stream.append("4567"); });
+    CHECK(appended.wait_for(std::chrono::milliseconds(10)) ==
+          std::future_status::timeout);
+    stream.cancel();
+    CHECK(!appended.get());
+}
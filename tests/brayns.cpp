@@ -109,3 +109,42 @@ TEST_CASE("bvh_type")
     CHECK(bvhFlags.count(brayns::BVHFlag::robust) > 0);
     CHECK(bvhFlags.count(brayns::BVHFlag::compact) > 0);
 }
+
+TEST_CASE("share_models")
+{
+    const char* argv[] = {"brayns", "demo"};
+    const int argc = sizeof(argv) / sizeof(char*);
+    brayns::Brayns brayns(argc, argv);
+    brayns.commit();
+
+    auto& engine = brayns.getEngine();
+    auto& scene = engine.getScene();
+    auto& pm = brayns.getParametersManager();
+    auto sharingScene =
+        engine.createScene(pm.getAnimationParameters(),
+                           pm.getGeometryParameters(),
+                           pm.getVolumeParameters());
+    sharingScene->shareModelsFrom(scene);
+
+    auto& model = scene.getModel(0)->getModel();
+    CHECK(sharingScene->sharesModels());
+    CHECK_EQ(&sharingScene->getModel(0)->getModel(), &model);
+
+    // commits without model changes keep sharing them
+    scene.markModified();
+    brayns.commit();
+    CHECK(sharingScene->sharesModels());
+
+    // changing a model gives the sharing scene a copy of it first
+    auto material = model.getMaterials().begin()->second;
+    material->setOpacity(0.5);
+    scene.markModified();
+    brayns.commit();
+    CHECK(!sharingScene->sharesModels());
+    CHECK(!material->isModified());
+
+    auto& copy = sharingScene->getModel(0)->getModel();
+    CHECK_NE(&copy, &model);
+    CHECK_EQ(copy.getMaterials().begin()->second->getOpacity(), 0.5);
+    CHECK_NOTHROW(sharingScene->commit());
+}
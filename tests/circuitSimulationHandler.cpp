@@ -0,0 +1,37 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include "../plugins/CircuitViewer/io/SimulationHandler.h"
+#include "StubReport.h"
+
+#include <brain/compartmentReport.h>
+
+TEST_CASE("frame_cache")
+{
+    stubReport::write();
+    brain::CompartmentReport report{brain::URI(stubReport::PATH)};
+    auto view = std::make_shared<brain::CompartmentReportView>(
+        report.createView(stubReport::GIDS));
+    brayns::SimulationHandler handler(view, true, "/tmp",
+                                      2 * stubReport::FRAME_BYTES);
+    stubReport::checkFrameCache(handler);
+}
@@ -0,0 +1,166 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <jsonSerialization.h>
+
+#include "ClientServer.h"
+#include <brayns/common/simulation/AbstractSimulationHandler.h>
+#include <brayns/common/utils/imageUtils.h>
+#include <brayns/engineapi/Engine.h>
+#include <brayns/engineapi/Material.h>
+#include <brayns/engineapi/Model.h>
+#include <brayns/engineapi/Renderer.h>
+#include <brayns/engineapi/Scene.h>
+
+#include <common/types.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <future>
+#include <thread>
+
+namespace
+{
+const uint32_t NB_FRAMES = 2;
+
+/**
+ * Loads each frame, whose values are all the frame number, on a background
+ * thread like the report based handlers do. Until the frame is loaded, the
+ * data of the previous frame is returned.
+ */
+class SlowSimulationHandler : public brayns::AbstractSimulationHandler
+{
+public:
+    SlowSimulationHandler()
+    {
+        _nbFrames = NB_FRAMES;
+        _frameSize = 1;
+        _dt = 1;
+        _currentFrame = 0;
+        _frameData = {0.f};
+    }
+
+    void* getFrameData(const uint32_t frame) final
+    {
+        const auto boundedFrame = _getBoundedFrame(frame);
+        if (boundedFrame == _currentFrame)
+            return _frameData.data();
+
+        if (!_loading.valid() || _loadingFrame != boundedFrame)
+        {
+            _loadingFrame = boundedFrame;
+            _loading = std::async(std::launch::async, [boundedFrame] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                return brayns::floats{float(boundedFrame)};
+            });
+        }
+
+        if (isReady())
+        {
+            _frameData = _loading.get();
+            _currentFrame = _loadingFrame;
+        }
+        return _frameData.data();
+    }
+
+    bool isReady() const final
+    {
+        return !_loading.valid() ||
+               _loading.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::ready;
+    }
+
+    void waitReady() const final
+    {
+        if (_loading.valid())
+            _loading.wait();
+    }
+
+    brayns::AbstractSimulationHandlerPtr clone() const final
+    {
+        auto handler = std::make_shared<SlowSimulationHandler>();
+        handler->_currentFrame = _currentFrame;
+        handler->_frameData = _frameData;
+        return handler;
+    }
+
+private:
+    uint32_t _loadingFrame{0};
+    std::future<brayns::floats> _loading;
+};
+
+brayns::freeimage::ImagePtr loadImage(const std::string& filename)
+{
+    brayns::freeimage::ImagePtr image(
+        FreeImage_Load(FIF_PNG, filename.c_str()));
+    std::remove(filename.c_str());
+    return image;
+}
+} // namespace
+
+TEST_CASE("export_simulation_frames")
+{
+    ClientServer clientServer({"--plugin", "braynsCircuitExplorer"});
+
+    auto& engine = clientServer.getBrayns().getEngine();
+    auto& scene = engine.getScene();
+    auto model = scene.createModel();
+    auto material = model->createMaterial(0, "sphere");
+    brayns::PropertyMap props;
+    props.setProperty({MATERIAL_PROPERTY_CAST_USER_DATA, true});
+    material->updateProperties(props);
+    model->addSphere(0, {{0, 0, 0}, 1.f, 0});
+
+    auto& transferFunction = model->getTransferFunction();
+    transferFunction.setColorMap({"red_blue", {{1, 0, 0}, {0, 0, 1}}});
+    transferFunction.setControlPoints({{0, 1}, {1, 1}});
+    transferFunction.setValuesRange({0, 1});
+
+    model->setSimulationHandler(std::make_shared<SlowSimulationHandler>());
+    scene.addModel(
+        std::make_shared<brayns::ModelDescriptor>(std::move(model), "sphere"));
+    engine.getRenderer().setCurrentType("circuit_explorer_basic");
+    clientServer.getBrayns().commitAndRender();
+
+    brayns::ExportFramesParams params;
+    params.path = "/tmp";
+    params.size = {50, 40};
+    params.cameras = {{{0, 0, 5}, {1, 0, 0, 0}, {0, 0, 0}},
+                      {{0, 0, 5}, {1, 0, 0, 0}, {0, 0, 0}}};
+    params.animationFrames = {0, 1};
+
+    const auto result =
+        clientServer.makeRequest<brayns::ExportFramesParams,
+                                 brayns::ExportFramesResult>("export-frames",
+                                                             params);
+    CHECK_EQ(result.framesWritten, 2u);
+
+    // the second frame must not be rendered before its data is loaded
+    auto first = loadImage("/tmp/00000.png");
+    auto second = loadImage("/tmp/00001.png");
+    REQUIRE(first);
+    REQUIRE(second);
+    const auto pitch = FreeImage_GetPitch(first.get());
+    REQUIRE_EQ(pitch, FreeImage_GetPitch(second.get()));
+    CHECK_NE(std::memcmp(FreeImage_GetBits(first.get()),
+                         FreeImage_GetBits(second.get()),
+                         pitch * FreeImage_GetHeight(first.get())),
+             0);
+}
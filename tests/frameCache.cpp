@@ -0,0 +1,93 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <brayns/common/simulation/FrameCache.h>
+
+#include <cmath>
+
+namespace
+{
+const uint64_t FRAME_SIZE = 1000;
+const uint32_t NB_FRAMES = 50;
+
+/**
+ * A synthetic compartment report: a voltage wave travelling along the
+ * compartments, so every frame has distinct values.
+ */
+brayns::floats syntheticFrame(const uint32_t frame)
+{
+    brayns::floats data(FRAME_SIZE);
+    for (uint64_t i = 0; i < FRAME_SIZE; ++i)
+        data[i] = -65.f + 30.f * std::sin(0.01f * i + 0.1f * frame);
+    return data;
+}
+} // namespace
+
+TEST_CASE("cache_frames")
+{
+    brayns::FrameCache cache("/tmp", FRAME_SIZE, NB_FRAMES,
+                             NB_FRAMES * FRAME_SIZE * sizeof(float));
+    CHECK_EQ(cache.getCapacity(), NB_FRAMES);
+
+    brayns::floats data;
+    CHECK(!cache.read(0, data));
+
+    for (uint32_t frame = 0; frame < NB_FRAMES; ++frame)
+        cache.write(frame, syntheticFrame(frame));
+
+    for (uint32_t frame = NB_FRAMES; frame-- > 0;)
+    {
+        REQUIRE(cache.read(frame, data));
+        CHECK(data == syntheticFrame(frame));
+    }
+}
+
+TEST_CASE("evict_least_recently_used_frames")
+{
+    brayns::FrameCache cache("/tmp", FRAME_SIZE, NB_FRAMES,
+                             3 * FRAME_SIZE * sizeof(float));
+    CHECK_EQ(cache.getCapacity(), 3);
+
+    brayns::floats data;
+    cache.write(0, syntheticFrame(0));
+    cache.write(1, syntheticFrame(1));
+    cache.write(2, syntheticFrame(2));
+    CHECK(cache.read(0, data));
+
+    cache.write(3, syntheticFrame(3));
+    CHECK(!cache.read(1, data));
+    REQUIRE(cache.read(0, data));
+    CHECK(data == syntheticFrame(0));
+    REQUIRE(cache.read(3, data));
+    CHECK(data == syntheticFrame(3));
+
+    const auto counters = cache.getCounters();
+    CHECK_EQ(counters.hits, 3);
+    CHECK_EQ(counters.misses, 1);
+    CHECK_EQ(counters.evictions, 1);
+}
+
+TEST_CASE("budget_too_small")
+{
+    CHECK_THROWS_AS(brayns::FrameCache("/tmp", FRAME_SIZE, NB_FRAMES, 10),
+                    std::runtime_error);
+}
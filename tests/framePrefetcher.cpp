@@ -0,0 +1,197 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <brayns/common/simulation/AbstractSimulationHandler.h>
+#include <brayns/common/simulation/FramePrefetcher.h>
+
+#include <mutex>
+
+namespace
+{
+brayns::floats loadFrame(const uint32_t frame)
+{
+    return brayns::floats(4, float(frame));
+}
+
+/** Takes its frames from the read-ahead like the circuit handlers. */
+class PrefetchingSimulationHandler : public brayns::AbstractSimulationHandler
+{
+public:
+    explicit PrefetchingSimulationHandler(
+        brayns::FramePrefetcher::LoadFunction loader)
+    {
+        _nbFrames = 10;
+        _frameSize = 4;
+        _setFrameLoader(std::move(loader));
+        setPrefetching(2, 1);
+    }
+
+    void* getFrameData(const uint32_t frame) final
+    {
+        _requestedFrame = _getBoundedFrame(frame);
+        _ready = _takePrefetchedFrame(_requestedFrame);
+        return _ready ? _getFrameData() : nullptr;
+    }
+
+    bool takeFrameData(const uint32_t frame, brayns::floats& buffer) final
+    {
+        return _handOverFrameData(frame, buffer);
+    }
+
+    bool isReady() const final { return _ready; }
+    void waitReady() const final
+    {
+        if (!_ready)
+            _waitPrefetchedFrame(_requestedFrame);
+    }
+
+    brayns::AbstractSimulationHandlerPtr clone() const final
+    {
+        return std::make_shared<PrefetchingSimulationHandler>(*this);
+    }
+
+private:
+    bool _ready{false};
+    uint32_t _requestedFrame{0};
+};
+} // namespace
+
+TEST_CASE("read_ahead_in_playback_direction")
+{
+    brayns::FramePrefetcher prefetcher(loadFrame, 10, 3);
+    brayns::floats data;
+
+    CHECK(!prefetcher.take(0, 1, data));
+    prefetcher.wait(0);
+    REQUIRE(prefetcher.take(0, 1, data));
+    CHECK_EQ(data[0], 0.f);
+
+    prefetcher.wait(3);
+    for (uint32_t frame = 1; frame <= 3; ++frame)
+    {
+        REQUIRE(prefetcher.take(frame, 1, data));
+        CHECK_EQ(data[0], float(frame));
+    }
+
+    const auto counters = prefetcher.getCounters();
+    CHECK_EQ(counters.hits, 3);
+    CHECK_EQ(counters.misses, 1);
+}
+
+TEST_CASE("read_ahead_wraps_around_backwards")
+{
+    brayns::FramePrefetcher prefetcher(loadFrame, 10, 2);
+    brayns::floats data;
+
+    CHECK(!prefetcher.take(1, -2, data));
+    prefetcher.wait(1);
+    REQUIRE(prefetcher.take(1, -2, data));
+
+    prefetcher.wait(9);
+    REQUIRE(prefetcher.take(9, -2, data));
+    CHECK_EQ(data[0], 9.f);
+}
+
+TEST_CASE("repeated_requests_count_as_stalls")
+{
+    std::mutex mutex;
+    mutex.lock();
+    brayns::FramePrefetcher prefetcher(
+        [&](const uint32_t frame) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return loadFrame(frame);
+        },
+        10, 2);
+    brayns::floats data;
+
+    CHECK(!prefetcher.take(5, 1, data));
+    CHECK(!prefetcher.take(5, 1, data));
+    mutex.unlock();
+    prefetcher.wait(5);
+    CHECK(prefetcher.take(5, 1, data));
+
+    const auto counters = prefetcher.getCounters();
+    CHECK_EQ(counters.hits, 0);
+    CHECK_EQ(counters.misses, 1);
+    CHECK_EQ(counters.stalls, 1);
+}
+
+TEST_CASE("back_to_current_frame_after_miss")
+{
+    std::mutex mutex;
+    PrefetchingSimulationHandler handler([&](const uint32_t frame) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return loadFrame(frame);
+    });
+
+    CHECK(!handler.getFrameData(5));
+    handler.waitReady();
+    REQUIRE(handler.getFrameData(5));
+    CHECK_EQ(handler.getCurrentFrame(), 5);
+
+    // a frame which is not read ahead and cannot load meanwhile
+    mutex.lock();
+    CHECK(!handler.getFrameData(9));
+    CHECK(!handler.isReady());
+
+    // the current frame is ready again right away
+    auto data = static_cast<const float*>(handler.getFrameData(5));
+    mutex.unlock();
+    CHECK(handler.isReady());
+    REQUIRE(data);
+    CHECK_EQ(data[0], 5.f);
+    CHECK_EQ(handler.getCurrentFrame(), 5);
+}
+
+TEST_CASE("hand_over_frame_data")
+{
+    PrefetchingSimulationHandler handler(loadFrame);
+    brayns::floats buffer;
+
+    CHECK(!handler.takeFrameData(3, buffer));
+    handler.waitReady();
+    REQUIRE(handler.takeFrameData(3, buffer));
+    REQUIRE_EQ(buffer.size(), 4);
+    CHECK_EQ(buffer[0], 3.f);
+
+    // the handler and its clones still have the values of the current frame
+    auto data = static_cast<const float*>(handler.getFrameData(3));
+    CHECK_EQ(data, buffer.data());
+    auto clone = handler.clone();
+    data = static_cast<const float*>(clone->getFrameData(3));
+    REQUIRE(data);
+    CHECK_NE(data, buffer.data());
+    CHECK_EQ(data[0], 3.f);
+
+    // the current frame is copied, as it is not in the handler anymore
+    brayns::floats otherBuffer;
+    REQUIRE(handler.takeFrameData(3, otherBuffer));
+    CHECK_EQ(otherBuffer, buffer);
+    CHECK_NE(otherBuffer.data(), buffer.data());
+
+    // the next frame is handed over again
+    while (!handler.takeFrameData(4, otherBuffer))
+        handler.waitReady();
+    CHECK_EQ(otherBuffer[0], 4.f);
+    data = static_cast<const float*>(handler.getFrameData(4));
+    CHECK_EQ(data, otherBuffer.data());
+}
@@ -0,0 +1,72 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <brayns/common/simulation/FrameTransforms.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// large enough to use the multithreaded code path
+const uint64_t FRAME_SIZE = 100000;
+
+brayns::floats syntheticFrame()
+{
+    brayns::floats data(FRAME_SIZE);
+    for (uint64_t i = 0; i < FRAME_SIZE; ++i)
+        data[i] = -65.f + 30.f * std::sin(0.01f * i);
+    return data;
+}
+} // namespace
+
+TEST_CASE("select_frame_values")
+{
+    const auto data = syntheticFrame();
+    brayns::uint8_ts mask;
+    brayns::selectFrameValues(data.data(), data.size(), -50.f, 5.f, mask);
+    REQUIRE_EQ(mask.size(), FRAME_SIZE);
+    for (uint64_t i = 0; i < FRAME_SIZE; ++i)
+        CHECK_EQ(mask[i] != 0, std::abs(data[i] + 50.f) < 5.f);
+}
+
+TEST_CASE("decay_frame_values")
+{
+    brayns::floats elapsed(FRAME_SIZE);
+    for (uint64_t i = 0; i < FRAME_SIZE; ++i)
+        elapsed[i] = i % 100;
+    elapsed[0] = std::numeric_limits<float>::infinity();
+
+    auto data = elapsed;
+    brayns::decayFrameValues(data.data(), data.size(), -1.f, -80.f, 2.f);
+    CHECK_EQ(data[0], -80.f);
+    for (uint64_t i = 1; i < FRAME_SIZE; ++i)
+        CHECK_EQ(data[i], std::max(-80.f, -1.f - elapsed[i] * 2.f));
+
+    // without decay, only the infinite times are at rest
+    data = elapsed;
+    brayns::decayFrameValues(data.data(), data.size(), -1.f, -80.f, 0.f);
+    CHECK_EQ(data[0], -80.f);
+    CHECK_EQ(data[1], -1.f);
+    CHECK_EQ(data[99], -1.f);
+}
@@ -0,0 +1,119 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include "../plugins/CircuitExplorer/plugin/meshing/MetaballsGenerator.h"
+
+#include <brayns/common/geometry/TriangleMesh.h>
+
+#include <cmath>
+#include <map>
+#include <set>
+#include <tuple>
+
+namespace
+{
+const float THRESHOLD = 1.f;
+
+// The field r²/d² (1 - d²/R²)² of a metaball of radius r, which fades out at
+// R² = 100 r² for a threshold of 1, reaches the threshold at this distance
+const float ISO_RADIUS = std::sqrt(2600.f) - 50.f;
+
+brayns::TriangleMesh generateMesh(const brayns::Vector4fs& metaballs,
+                                  const size_t gridSize)
+{
+    brayns::TriangleMeshMap triangles;
+    MetaballsGenerator generator;
+    generator.generateMesh(metaballs, gridSize, THRESHOLD, 0, triangles);
+    return triangles[0];
+}
+
+void checkClosed(const brayns::TriangleMesh& mesh)
+{
+    std::map<std::pair<uint32_t, uint32_t>, size_t> edges;
+    for (const auto& triangle : mesh.indices)
+    {
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const auto a = triangle[i];
+            const auto b = triangle[(i + 1) % 3];
+            ++edges[std::make_pair(std::min(a, b), std::max(a, b))];
+        }
+    }
+    REQUIRE_FALSE(edges.empty());
+    for (const auto& edge : edges)
+        CHECK_EQ(edge.second, 2);
+}
+
+void checkUniqueVertices(const brayns::TriangleMesh& mesh)
+{
+    std::set<std::tuple<float, float, float>> positions;
+    for (const auto& vertex : mesh.vertices)
+        positions.emplace(vertex.x, vertex.y, vertex.z);
+    CHECK_EQ(positions.size(), mesh.vertices.size());
+}
+} // namespace
+
+TEST_CASE("metaballs_one_metaball")
+{
+    const brayns::Vector3f center(1.f, 2.f, 3.f);
+    const float radius = 0.5f;
+    const auto mesh = generateMesh({{center, radius}}, 16);
+
+    checkClosed(mesh);
+    checkUniqueVertices(mesh);
+    REQUIRE_EQ(mesh.normals.size(), mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); ++i)
+    {
+        const auto toVertex = mesh.vertices[i] - center;
+        CHECK_EQ(glm::length(toVertex),
+                 doctest::Approx(ISO_RADIUS * radius).epsilon(0.05));
+        CHECK_GT(glm::dot(mesh.normals[i], toVertex), 0.f);
+    }
+}
+
+TEST_CASE("metaballs_block_seam")
+{
+    // The grid is meshed in two blocks of 16 slabs, whose seam goes through
+    // the middle of the metaballs
+    const brayns::Vector4fs metaballs{{0.f, -0.3f, 0.f, 0.5f},
+                                      {0.f, 0.3f, 0.f, 0.5f}};
+    const auto mesh = generateMesh(metaballs, 32);
+
+    checkClosed(mesh);
+    checkUniqueVertices(mesh);
+
+    // The same surface as with a single block, up to the sampling of the grid
+    const auto singleBlockMesh = generateMesh(metaballs, 16);
+    brayns::Box<float> bounds;
+    for (const auto& vertex : mesh.vertices)
+        bounds.merge(vertex);
+    brayns::Box<float> singleBlockBounds;
+    for (const auto& vertex : singleBlockMesh.vertices)
+        singleBlockBounds.merge(vertex);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        CHECK_EQ(bounds.getMin()[i],
+                 doctest::Approx(singleBlockBounds.getMin()[i]).epsilon(0.1));
+        CHECK_EQ(bounds.getMax()[i],
+                 doctest::Approx(singleBlockBounds.getMax()[i]).epsilon(0.1));
+    }
+}
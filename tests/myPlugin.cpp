@@ -34,6 +34,19 @@
 using Vec2 = std::array<unsigned, 2>;
 const Vec2 vecVal{{1, 1}};
 
+struct Attached
+{
+    std::string chunksID;
+};
+
+namespace staticjson
+{
+inline void init(Attached* a, ObjectHandler* h)
+{
+    h->add_property("chunks_id", &a->chunksID);
+}
+} // namespace staticjson
+
 class MyPlugin : public brayns::ExtensionPlugin
 {
 public:
@@ -111,6 +124,15 @@ public:
             ++numCalls;
             return vec;
         });
+        actions->registerBinaryNotification<Attached>(
+            "attached",
+            [&](const Attached&, const brayns::uint8_ts& attachment) {
+                ++numCalls;
+                REQUIRE_EQ(attachment.size(), sizeof(Vec2));
+                Vec2 vec;
+                memcpy(vec.data(), attachment.data(), sizeof(Vec2));
+                CHECK(vec == vecVal);
+            });
 
         // test properties from custom renderer
         brayns::PropertyMap props;
@@ -124,7 +146,7 @@ public:
 
     ~MyPlugin()
     {
-        REQUIRE_EQ(numCalls, 10);
+        REQUIRE_EQ(numCalls, 11);
         REQUIRE_EQ(numFails, 1);
     }
     size_t numCalls{0};
@@ -0,0 +1,131 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include <brayns/Brayns.h>
+
+#include <brayns/common/Timer.h>
+#include <brayns/engineapi/Camera.h>
+#include <brayns/engineapi/Engine.h>
+#include <brayns/engineapi/FrameBuffer.h>
+#include <brayns/engineapi/Model.h>
+#include <brayns/engineapi/Renderer.h>
+#include <brayns/engineapi/Scene.h>
+#include <brayns/engineapi/SharedDataVolume.h>
+#include <brayns/parameters/ParametersManager.h>
+
+#include <cstdlib>
+#include <iostream>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+const uint32_t VOLUME_SIZE = 256;
+const float BLOB_RADIUS = 24.f;
+
+// A few blobs in an otherwise empty volume, like a sparse brain region
+brayns::uint8_ts createSparseVolume()
+{
+    const brayns::Vector3f blobs[] = {{64.f, 64.f, 64.f},
+                                      {128.f, 160.f, 96.f},
+                                      {192.f, 96.f, 200.f}};
+    brayns::floats voxels(VOLUME_SIZE * VOLUME_SIZE * VOLUME_SIZE, 0.f);
+    for (uint32_t z = 0; z < VOLUME_SIZE; ++z)
+        for (uint32_t y = 0; y < VOLUME_SIZE; ++y)
+            for (uint32_t x = 0; x < VOLUME_SIZE; ++x)
+                for (const auto& blob : blobs)
+                {
+                    const float distance =
+                        glm::length(brayns::Vector3f(x, y, z) - blob);
+                    if (distance < BLOB_RADIUS)
+                        voxels[(z * VOLUME_SIZE + y) * VOLUME_SIZE + x] =
+                            1.f - distance / BLOB_RADIUS;
+                }
+    const auto bytes = reinterpret_cast<const uint8_t*>(voxels.data());
+    return brayns::uint8_ts(bytes, bytes + voxels.size() * sizeof(float));
+}
+
+uint64_t render(brayns::Brayns& brayns, const bool emptySpaceSkipping,
+                brayns::uint8_ts& image)
+{
+    auto& renderer = brayns.getEngine().getRenderer();
+    renderer.updateProperty("emptySpaceSkipping", emptySpaceSkipping);
+
+    // same random number for the ray jitter in both renderings
+    std::srand(0);
+    brayns.commit();
+
+    brayns::Timer timer;
+    timer.start();
+    brayns.render();
+    timer.stop();
+
+    auto& frameBuffer = brayns.getEngine().getFrameBuffer();
+    frameBuffer.map();
+    const auto size = frameBuffer.getSize();
+    const auto colors = frameBuffer.getColorBuffer();
+    image.assign(colors,
+                 colors + size.x * size.y * frameBuffer.getColorDepth());
+    frameBuffer.unmap();
+    return timer.milliseconds();
+}
+} // namespace
+
+TEST_CASE("empty_space_skipping_benchmark")
+{
+    std::vector<const char*> argv = {
+        {"emptySpaceSkipping", "--disable-accumulation", "--window-size",
+         "1024", "1024", "--plugin", "braynsCircuitExplorer"}};
+    brayns::Brayns brayns(argv.size(), argv.data());
+    brayns.getParametersManager().getRenderingParameters().setCurrentRenderer(
+        "circuit_explorer_advanced");
+
+    auto& scene = brayns.getEngine().getScene();
+    auto model = scene.createModel();
+    auto volume = model->createSharedDataVolume(
+        brayns::Vector3ui(VOLUME_SIZE), brayns::Vector3f(1.f),
+        brayns::DataType::FLOAT);
+    volume->setDataRange({0.f, 1.f});
+    volume->mapData(createSparseVolume());
+    model->addVolume(volume);
+    model->getTransferFunction().setValuesRange({0., 1.});
+    model->getTransferFunction().setControlPoints({{0., 0.}, {1., 1.}});
+    scene.addModel(
+        std::make_shared<brayns::ModelDescriptor>(std::move(model), "Blobs"));
+    brayns.getEngine().getCamera().setPosition({128.f, 128.f, 640.f});
+
+    brayns::uint8_ts reference, skipped;
+    const auto referenceTime = render(brayns, false, reference);
+    const auto skippingTime = render(brayns, true, skipped);
+    std::cout << "Without empty space skipping: " << referenceTime << " ms"
+              << std::endl;
+    std::cout << "With empty space skipping: " << skippingTime << " ms"
+              << std::endl;
+
+    // sample positions only differ by rounding
+    REQUIRE_EQ(reference.size(), skipped.size());
+    size_t differences = 0;
+    for (size_t i = 0; i < reference.size(); ++i)
+        if (std::abs(int(reference[i]) - int(skipped[i])) > 1)
+            ++differences;
+    CHECK_EQ(differences, 0);
+    CHECK_LT(skippingTime, referenceTime);
+}
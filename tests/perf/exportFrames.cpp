@@ -0,0 +1,119 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <ExportFramesTask.h>
+#include <ImageWriter.h>
+
+#include <brayns/Brayns.h>
+
+#include <brayns/common/Timer.h>
+#include <brayns/engineapi/Camera.h>
+#include <brayns/engineapi/Engine.h>
+#include <brayns/engineapi/FrameBuffer.h>
+#include <brayns/parameters/ParametersManager.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <unistd.h>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+const size_t NB_FRAMES = 1000;
+const brayns::Vector2ui FRAME_SIZE{320, 240};
+
+std::string getFilename(const std::string& dir, const size_t frame)
+{
+    char filename[16];
+    snprintf(filename, sizeof(filename), "/%05zu.png", frame);
+    return dir + filename;
+}
+
+void removeFrames(const std::string& dir)
+{
+    for (size_t frame = 0; frame < NB_FRAMES; ++frame)
+        std::remove(getFilename(dir, frame).c_str());
+}
+} // namespace
+
+TEST_CASE("export_frames_benchmark")
+{
+    const char* argv[] = {"brayns", "demo"};
+    const int argc = sizeof(argv) / sizeof(char*);
+    brayns::Brayns brayns(argc, argv);
+    brayns.getParametersManager().getApplicationParameters().setWindowSize(
+        FRAME_SIZE);
+    brayns.commit();
+
+    char dir[] = "/tmp/brayns_export_XXXXXX";
+    REQUIRE(mkdtemp(dir));
+
+    // move the camera a little per frame, so no frame is like the previous
+    std::vector<brayns::CameraKeyframe> cameras;
+    for (size_t frame = 0; frame < NB_FRAMES; ++frame)
+    {
+        const double x = 0.5 + 0.001 * frame;
+        cameras.push_back({{x, 0.5, 1.5}, {1, 0, 0, 0}, {x, 0.5, 0.5}});
+    }
+
+    brayns::Timer timer;
+
+    // baseline: encode and write each frame before rendering the next one
+    auto& engine = brayns.getEngine();
+    timer.start();
+    for (size_t frame = 0; frame < NB_FRAMES; ++frame)
+    {
+        const auto& keyframe = cameras[frame];
+        engine.getCamera().set(keyframe.position, keyframe.orientation,
+                               keyframe.target);
+        brayns.commit();
+        brayns.render();
+        CHECK(brayns::writeImageToFile(engine.getFrameBuffer().getImage(),
+                                       "png", 100, getFilename(dir, frame)));
+    }
+    timer.stop();
+    const auto sequential = timer.milliseconds();
+    removeFrames(dir);
+
+    // export: the image writer encodes and writes while the next frame renders
+    brayns::AsyncImageWriter imageWriter;
+    brayns::ExportFramesParams params;
+    params.path = dir;
+    params.size = FRAME_SIZE;
+    params.cameras = cameras;
+    brayns::ExportFramesFunctor exportFrames(engine, std::move(params),
+                                             imageWriter);
+    timer.start();
+    const auto result = exportFrames();
+    timer.stop();
+    const auto exported = timer.milliseconds();
+    CHECK_EQ(result.framesWritten, NB_FRAMES);
+    removeFrames(dir);
+    rmdir(dir);
+
+    std::cout << "Export of " << NB_FRAMES << " frames of " << FRAME_SIZE.x
+              << "x" << FRAME_SIZE.y << ": " << sequential
+              << " ms writing each frame before the next one ("
+              << NB_FRAMES * 1000. / sequential << " fps), " << exported
+              << " ms with the image writer ("
+              << NB_FRAMES * 1000. / exported << " fps)" << std::endl;
+}
@@ -0,0 +1,80 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/common/simulation/FrameTransforms.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+const uint64_t FRAME_SIZE = 100000000;
+
+template <typename Func>
+void benchmark(const std::string& name, const Func& func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const std::chrono::duration<float, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::cout << name << ": " << elapsed.count() << " ms" << std::endl;
+}
+} // namespace
+
+TEST_CASE("frame_transforms_benchmark")
+{
+    brayns::floats data(FRAME_SIZE);
+    for (uint64_t i = 0; i < FRAME_SIZE; ++i)
+        data[i] = -65.f + 30.f * std::sin(0.001f * i);
+    brayns::uint8_ts mask(FRAME_SIZE);
+
+    size_t scalarSelected = 0;
+    benchmark("Scalar select", [&] {
+        for (uint64_t i = 0; i < FRAME_SIZE; ++i)
+            if (std::abs(data[i] + 50.f) < 1.f)
+                ++scalarSelected;
+    });
+
+    benchmark("Select", [&] {
+        brayns::selectFrameValues(data.data(), FRAME_SIZE, -50.f, 1.f, mask);
+    });
+    size_t selected = 0;
+    for (const auto value : mask)
+        selected += value;
+    CHECK_EQ(selected, scalarSelected);
+
+    // frames elapsed since the last spike, as computed by SpikeIndex
+    for (uint64_t i = 0; i < FRAME_SIZE; ++i)
+        data[i] = i % 1000;
+    brayns::floats scalarDecayed(FRAME_SIZE);
+    benchmark("Scalar decay", [&] {
+        for (uint64_t i = 0; i < FRAME_SIZE; ++i)
+            scalarDecayed[i] = std::max(-80.f, -1.f - data[i] * 0.1f);
+    });
+
+    benchmark("Decay", [&] {
+        brayns::decayFrameValues(data.data(), FRAME_SIZE, -1.f, -80.f, 0.1f);
+    });
+    CHECK(data == scalarDecayed);
+}
@@ -0,0 +1,224 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/common/Timer.h>
+#include <brayns/common/utils/lowDiscrepancy.h>
+
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+// Measures the number of accumulation frames it takes for a pixel shaded by
+// global illumination and soft shadows to converge, with the scrambled Sobol
+// sampler of the renderers and with the precomputed random table it replaced.
+// Each pixel is lit if both its global illumination direction and its soft
+// shadow direction pass an occluder, whose extent varies over the image. The
+// exact value is known, so no reference image needs to be rendered.
+
+namespace
+{
+const size_t IMAGE_SIZE = 128;
+const size_t MAX_FRAMES = 1024;
+const double EQUAL_ERROR_RMSE = 3.;
+const unsigned int RENDERER_SEED = 42;
+
+// Effects of the renderer, like in CircuitExplorerAdvancedRenderer.ispc
+const unsigned int EFFECT_GLOBAL_ILLUMINATION = 1;
+const unsigned int EFFECT_SOFT_SHADOWS = 4;
+
+struct Direction
+{
+    float x;
+    float y;
+};
+
+// Cosine weighted hemisphere direction around z, projected on the xy plane
+Direction toDirection(const float rx, const float ry)
+{
+    const float w = std::sqrt(1.f - ry);
+    return {std::cos(2.f * float(M_PI) * rx) * w,
+            std::sin(2.f * float(M_PI) * rx) * w};
+}
+
+// Probability for a cosine weighted direction to have x below the occluder
+// at 'extent': the projected directions are uniform over the unit disk.
+double getVisibility(const double extent)
+{
+    return 1. -
+           (std::acos(extent) - extent * std::sqrt(1. - extent * extent)) /
+               M_PI;
+}
+
+double getOccluderExtent(const size_t i)
+{
+    return -0.9 + 1.8 * double(i) / double(IMAGE_SIZE - 1);
+}
+
+class Sampler
+{
+public:
+    virtual ~Sampler() = default;
+    // The GI and soft shadow directions of a pixel in the given frame
+    virtual void getDirections(size_t x, size_t y, size_t frame,
+                               Direction& gi, Direction& softShadows) const = 0;
+};
+
+/**
+ * The sampler of the renderers, see LowDiscrepancy.ih. Each effect has its own
+ * sampling dimension.
+ */
+class SobolSampler : public Sampler
+{
+public:
+    void getDirections(const size_t x, const size_t y, const size_t frame,
+                       Direction& gi, Direction& softShadows) const final
+    {
+        gi = _getDirection(x, y, frame, EFFECT_GLOBAL_ILLUMINATION);
+        softShadows = _getDirection(x, y, frame, EFFECT_SOFT_SHADOWS);
+    }
+
+private:
+    Direction _getDirection(const size_t x, const size_t y, const size_t frame,
+                            const unsigned int effect) const
+    {
+        const auto dimension =
+            brayns::getSamplingDimension(effect, 0, RENDERER_SEED);
+        float rx, ry;
+        brayns::getSobolSample(frame, brayns::getPixelSeed(x, y, dimension),
+                               rx, ry);
+        return toDirection(rx, ry);
+    }
+};
+
+/**
+ * The former sampler of the renderers: a 64x64 table of random values per
+ * pixel, rotated by a Halton offset of the accumulation frame. All effects got
+ * the same direction.
+ */
+class RandomTableSampler : public Sampler
+{
+public:
+    RandomTableSampler()
+    {
+        std::mt19937 generator(RENDERER_SEED);
+        std::uniform_real_distribution<float> distribution(0.f, 1.f);
+        for (auto& row : _table)
+            for (auto& value : row)
+                value = distribution(generator);
+    }
+
+    void getDirections(const size_t x, const size_t y, const size_t frame,
+                       Direction& gi, Direction& softShadows) const final
+    {
+        const size_t accumID = frame + RENDERER_SEED;
+        const float rotX = 1.f - _halton(accumID % NB_HALTON_VALUES, 3);
+        const float rotY = 1.f - _halton(accumID % NB_HALTON_VALUES, 5);
+        const size_t tx = x % TABLE_SIZE;
+        const size_t ty = y % TABLE_SIZE;
+        gi = toDirection(_rotate(_table[ty][TABLE_SIZE - 1 - tx], rotX),
+                         _rotate(_table[TABLE_SIZE - 1 - tx][ty], rotY));
+        softShadows = gi;
+    }
+
+private:
+    static const size_t TABLE_SIZE = 64;
+    // Like OSPRay's precomputed Halton values
+    static const size_t NB_HALTON_VALUES = 256;
+    std::array<std::array<float, TABLE_SIZE>, TABLE_SIZE> _table;
+
+    static float _rotate(float x, const float dx)
+    {
+        x += dx;
+        if (x >= 1.f)
+            x -= 1.f;
+        return x;
+    }
+
+    static float _halton(size_t index, const size_t base)
+    {
+        float result = 0.f;
+        float fraction = 1.f / base;
+        for (; index > 0; index /= base, fraction /= base)
+            result += fraction * (index % base);
+        return result;
+    }
+};
+
+struct Convergence
+{
+    size_t frames{0};
+    uint64_t milliseconds{0};
+};
+
+// Accumulates frames until the error to the exact image drops below
+// EQUAL_ERROR_RMSE
+Convergence accumulateToEqualError(const Sampler& sampler)
+{
+    std::vector<double> sums(IMAGE_SIZE * IMAGE_SIZE, 0.);
+    Convergence convergence;
+    brayns::Timer timer;
+    timer.start();
+    while (convergence.frames < MAX_FRAMES)
+    {
+        const size_t frame = convergence.frames++;
+        double squaredError = 0.;
+        for (size_t y = 0; y < IMAGE_SIZE; ++y)
+        {
+            const auto shadowExtent = getOccluderExtent(y);
+            for (size_t x = 0; x < IMAGE_SIZE; ++x)
+            {
+                const auto giExtent = getOccluderExtent(x);
+                Direction gi, softShadows;
+                sampler.getDirections(x, y, frame, gi, softShadows);
+                auto& sum = sums[y * IMAGE_SIZE + x];
+                if (gi.x < giExtent && softShadows.x < shadowExtent)
+                    sum += 1.;
+
+                const double exact =
+                    getVisibility(giExtent) * getVisibility(shadowExtent);
+                const double error = 255. * (sum / convergence.frames - exact);
+                squaredError += error * error;
+            }
+        }
+        if (std::sqrt(squaredError / sums.size()) < EQUAL_ERROR_RMSE)
+            break;
+    }
+    timer.stop();
+    convergence.milliseconds = timer.milliseconds();
+    return convergence;
+}
+} // namespace
+
+TEST_CASE("low_discrepancy_sampling_benchmark")
+{
+    const auto sobol = accumulateToEqualError(SobolSampler());
+    const auto randomTable = accumulateToEqualError(RandomTableSampler());
+    std::cout << "Low-discrepancy sampler: " << sobol.frames << " frames, "
+              << sobol.milliseconds << " ms" << std::endl;
+    std::cout << "Random table: " << randomTable.frames << " frames, "
+              << randomTable.milliseconds << " ms" << std::endl;
+
+    CHECK_LT(sobol.frames, MAX_FRAMES);
+    CHECK_LT(sobol.frames, randomTable.frames);
+}
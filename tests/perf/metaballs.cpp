@@ -0,0 +1,74 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "../../plugins/CircuitExplorer/plugin/meshing/MetaballsGenerator.h"
+
+#include <brayns/common/Timer.h>
+#include <brayns/common/geometry/TriangleMesh.h>
+
+#include <iostream>
+#include <random>
+
+#include <sys/resource.h>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+/** Synapse-like metaballs, densely packed in a unit cube. */
+brayns::Vector4fs randomMetaballs(const size_t count)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(0.f, 1.f);
+    std::uniform_real_distribution<float> radius(0.002f, 0.004f);
+    brayns::Vector4fs metaballs(count);
+    for (auto& metaball : metaballs)
+        metaball = {position(rng), position(rng), position(rng), radius(rng)};
+    return metaballs;
+}
+} // namespace
+
+TEST_CASE("metaballs_benchmark")
+{
+    for (const size_t count : {1000, 10000, 100000})
+    {
+        const auto metaballs = randomMetaballs(count);
+        for (const size_t gridSize : {64, 128, 256, 512})
+        {
+            brayns::TriangleMeshMap triangles;
+            MetaballsGenerator generator;
+
+            brayns::Timer timer;
+            timer.start();
+            generator.generateMesh(metaballs, gridSize, 1.f, 0, triangles);
+            timer.stop();
+
+            std::cout << count << " metaballs, grid size " << gridSize << ": "
+                      << timer.milliseconds() << " ms, "
+                      << triangles[0].indices.size() << " triangles"
+                      << std::endl;
+        }
+    }
+
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << "Peak memory: " << usage.ru_maxrss / 1024 << " MB"
+              << std::endl;
+}
@@ -0,0 +1,153 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/Brayns.h>
+
+#include <brayns/common/Timer.h>
+#include <brayns/engineapi/Camera.h>
+#include <brayns/engineapi/Engine.h>
+#include <brayns/engineapi/FrameBuffer.h>
+#include <brayns/engineapi/Material.h>
+#include <brayns/engineapi/Model.h>
+#include <brayns/engineapi/Renderer.h>
+#include <brayns/engineapi/Scene.h>
+#include <brayns/parameters/ParametersManager.h>
+
+#include <cmath>
+#include <iostream>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+const size_t GRID_SIZE = 10;
+const float SPHERE_RADIUS = 0.55f;
+const int REFERENCE_SAMPLES = 64;
+const size_t REFERENCE_FRAMES = 64;
+const size_t MAX_FRAMES = 256;
+const double CONVERGED_RMSE = 2.;
+
+// Touching spheres alternating between two materials
+brayns::ModelDescriptorPtr createModel(brayns::Scene& scene)
+{
+    auto model = scene.createModel();
+    model->createMaterial(0, "even")->setDiffuseColor({1.f, 1.f, 1.f});
+    model->createMaterial(1, "odd")->setDiffuseColor({0.5f, 0.5f, 1.f});
+    for (size_t z = 0; z < GRID_SIZE; ++z)
+        for (size_t y = 0; y < GRID_SIZE; ++y)
+            for (size_t x = 0; x < GRID_SIZE; ++x)
+                model->addSphere((x + y + z) % 2,
+                                 {brayns::Vector3f(x, y, z), SPHERE_RADIUS});
+    return std::make_shared<brayns::ModelDescriptor>(std::move(model),
+                                                     "Spheres");
+}
+
+void getImage(brayns::Brayns& brayns, brayns::uint8_ts& image)
+{
+    auto& frameBuffer = brayns.getEngine().getFrameBuffer();
+    frameBuffer.map();
+    const auto size = frameBuffer.getSize();
+    const auto colors = frameBuffer.getColorBuffer();
+    image.assign(colors,
+                 colors + size.x * size.y * frameBuffer.getColorDepth());
+    frameBuffer.unmap();
+}
+
+double rmse(const brayns::uint8_ts& image, const brayns::uint8_ts& reference)
+{
+    double sum = 0.;
+    for (size_t i = 0; i < image.size(); ++i)
+    {
+        const double difference = double(image[i]) - double(reference[i]);
+        sum += difference * difference;
+    }
+    return std::sqrt(sum / image.size());
+}
+
+void setDetectionSamples(brayns::Brayns& brayns, const int samples)
+{
+    brayns.getEngine().getRenderer().updateProperty("detectionSamples",
+                                                    samples);
+    brayns.commit();
+}
+
+// Accumulates frames until the image is close to the reference, returns the
+// time it took and the number of frames
+std::pair<uint64_t, size_t> timeToConverge(
+    brayns::Brayns& brayns, const int samples,
+    const brayns::uint8_ts& reference)
+{
+    setDetectionSamples(brayns, samples);
+
+    brayns::uint8_ts image;
+    brayns::Timer timer;
+    uint64_t milliseconds = 0;
+    size_t frames = 0;
+    while (frames < MAX_FRAMES)
+    {
+        timer.start();
+        brayns.commit();
+        brayns.render();
+        timer.stop();
+        milliseconds += timer.milliseconds();
+        ++frames;
+
+        getImage(brayns, image);
+        if (rmse(image, reference) < CONVERGED_RMSE)
+            break;
+    }
+    return {milliseconds, frames};
+}
+} // namespace
+
+TEST_CASE("proximity_detection_convergence_benchmark")
+{
+    std::vector<const char*> argv = {
+        {"proximityDetection", "--window-size", "512", "512",
+         "--max-accumulation-frames", "1000", "--plugin",
+         "braynsCircuitExplorer"}};
+    brayns::Brayns brayns(argv.size(), argv.data());
+    brayns.getParametersManager().getRenderingParameters().setCurrentRenderer(
+        "circuit_explorer_proximity_detection");
+    brayns.getEngine().getRenderer().updateProperty("detectionDistance", 0.5);
+
+    auto& scene = brayns.getEngine().getScene();
+    scene.addModel(createModel(scene));
+    brayns.getEngine().getCamera().setPosition({4.5, 4.5, 20.});
+
+    setDetectionSamples(brayns, REFERENCE_SAMPLES);
+    for (size_t i = 0; i < REFERENCE_FRAMES; ++i)
+    {
+        brayns.commit();
+        brayns.render();
+    }
+    brayns::uint8_ts reference;
+    getImage(brayns, reference);
+
+    const auto single = timeToConverge(brayns, 1, reference);
+    const auto batched = timeToConverge(brayns, 8, reference);
+    std::cout << "1 probe per frame: " << single.second << " frames, "
+              << single.first << " ms" << std::endl;
+    std::cout << "8 probes per frame: " << batched.second << " frames, "
+              << batched.first << " ms" << std::endl;
+
+    CHECK_LT(batched.second, MAX_FRAMES);
+    CHECK_LT(batched.first, single.first);
+}
@@ -0,0 +1,148 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/Brayns.h>
+
+#include <brayns/common/Timer.h>
+#include <brayns/common/geometry/SDFBezier.h>
+#include <brayns/engineapi/Camera.h>
+#include <brayns/engineapi/Engine.h>
+#include <brayns/engineapi/Material.h>
+#include <brayns/engineapi/Model.h>
+#include <brayns/engineapi/Scene.h>
+
+#include <iostream>
+#include <random>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+const size_t NUM_CURVES = 2000;
+const float CURVE_LENGTH = 20.f;
+const float CURVE_RADIUS = 0.2f;
+const float SUBDIVISION_TOLERANCE = 0.1f;
+
+// Long, strongly bent and thin curves, the worst case for per-curve bounds
+brayns::SDFBeziers createCurves()
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-50.f, 50.f);
+    std::normal_distribution<float> normal;
+    const auto randomDirection = [&] {
+        return glm::normalize(
+            brayns::Vector3f(normal(rng), normal(rng), normal(rng)));
+    };
+
+    brayns::SDFBeziers curves;
+    for (size_t i = 0; i < NUM_CURVES; ++i)
+    {
+        const brayns::Vector3f p0(position(rng), position(rng), position(rng));
+        const brayns::Vector3f p1 = p0 + randomDirection() * CURVE_LENGTH;
+        const brayns::Vector3f c0 = p0 + randomDirection() * CURVE_LENGTH;
+        const brayns::Vector3f c1 = p1 + randomDirection() * CURVE_LENGTH;
+        curves.push_back({i, p0, c0, CURVE_RADIUS, p1, c1, CURVE_RADIUS});
+    }
+    return curves;
+}
+
+double surfaceArea(const brayns::Boxd& box)
+{
+    const auto size = box.getSize();
+    return 2. * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+// Number of bounds a random ray through the scene enters, the surface area
+// heuristic estimate for intersection calls per ray
+double expectedIntersectionsPerRay(const brayns::SDFBeziers& curves)
+{
+    brayns::Boxd sceneBounds;
+    double area = 0.;
+    for (const auto& curve : curves)
+    {
+        const auto bounds = bezierBounds(curve);
+        sceneBounds.merge(bounds);
+        area += surfaceArea(bounds);
+    }
+    return area / surfaceArea(sceneBounds);
+}
+
+brayns::ModelDescriptorPtr createModel(brayns::Scene& scene,
+                                       const brayns::SDFBeziers& curves,
+                                       const std::string& name)
+{
+    auto model = scene.createModel();
+    model->createMaterial(0, name)->setDiffuseColor({1.f, 1.f, 1.f});
+    for (const auto& curve : curves)
+        model->addSDFBezier(0, curve);
+    return std::make_shared<brayns::ModelDescriptor>(std::move(model), name);
+}
+
+uint64_t render(brayns::Brayns& brayns)
+{
+    const size_t numFrames = 10;
+
+    brayns.commit();
+    brayns.render(); // BVH build
+
+    brayns::Timer timer;
+    timer.start();
+    for (size_t i = 0; i < numFrames; ++i)
+        brayns.render();
+    timer.stop();
+    return timer.milliseconds() / numFrames;
+}
+} // namespace
+
+TEST_CASE("sdf_bezier_subdivision_benchmark")
+{
+    std::vector<const char*> argv = {
+        {"sdfBezierSubdivision", "--disable-accumulation", "--window-size",
+         "1024", "1024"}};
+    brayns::Brayns brayns(argv.size(), argv.data());
+
+    const auto curves = createCurves();
+    brayns::SDFBeziers pieces;
+    for (const auto& curve : curves)
+        subdivideBezier(curve, SUBDIVISION_TOLERANCE, pieces);
+
+    auto& scene = brayns.getEngine().getScene();
+    brayns.getEngine().getCamera().setPosition({0., 0., 200.});
+
+    const auto wholeId = scene.addModel(createModel(scene, curves, "whole"));
+    const auto wholeTime = render(brayns);
+    scene.removeModel(wholeId);
+
+    scene.addModel(createModel(scene, pieces, "subdivided"));
+    const auto subdividedTime = render(brayns);
+
+    const auto wholeCalls = expectedIntersectionsPerRay(curves);
+    const auto subdividedCalls = expectedIntersectionsPerRay(pieces);
+
+    std::cout << "Whole curves: " << curves.size() << " primitives, "
+              << wholeCalls << " intersections per ray, " << wholeTime
+              << " ms" << std::endl;
+    std::cout << "Subdivided curves: " << pieces.size() << " primitives, "
+              << subdividedCalls << " intersections per ray, "
+              << subdividedTime << " ms" << std::endl;
+
+    CHECK_LT(subdividedCalls, wholeCalls);
+    CHECK_LE(subdividedTime, wholeTime);
+}
@@ -0,0 +1,198 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include <brayns/Brayns.h>
+
+#include <brayns/common/Timer.h>
+#include <brayns/common/geometry/SDFGeometry.h>
+#include <brayns/engineapi/Camera.h>
+#include <brayns/engineapi/Engine.h>
+#include <brayns/engineapi/FrameBuffer.h>
+#include <brayns/engineapi/Material.h>
+#include <brayns/engineapi/Model.h>
+#include <brayns/engineapi/Renderer.h>
+#include <brayns/engineapi/Scene.h>
+#include <brayns/parameters/ParametersManager.h>
+
+#include <iostream>
+#include <random>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+const size_t NUM_DENDRITES = 40;
+const size_t NUM_SEGMENTS = 60;
+const float SEGMENT_LENGTH = 1.5f;
+const float SOMA_RADIUS = 4.f;
+const float DENDRITE_START_RADIUS = 0.8f;
+const float DENDRITE_END_RADIUS = 0.05f;
+
+struct Segment
+{
+    brayns::Vector3f p0;
+    brayns::Vector3f p1;
+    float r0;
+    float r1;
+};
+
+// Long, thin and tapering dendrites around a soma at the origin
+std::vector<std::vector<Segment>> createMorphology()
+{
+    std::mt19937 rng(42);
+    std::normal_distribution<float> normal;
+    std::vector<std::vector<Segment>> dendrites(NUM_DENDRITES);
+    for (auto& dendrite : dendrites)
+    {
+        brayns::Vector3f direction =
+            glm::normalize(brayns::Vector3f(normal(rng), normal(rng),
+                                            normal(rng)));
+        brayns::Vector3f p = direction * SOMA_RADIUS;
+        float r = DENDRITE_START_RADIUS;
+        for (size_t i = 0; i < NUM_SEGMENTS; ++i)
+        {
+            direction = glm::normalize(
+                direction +
+                0.3f * brayns::Vector3f(normal(rng), normal(rng), normal(rng)));
+            const float nextR =
+                DENDRITE_START_RADIUS +
+                (DENDRITE_END_RADIUS - DENDRITE_START_RADIUS) * (i + 1) /
+                    NUM_SEGMENTS;
+            const brayns::Vector3f next = p + direction * SEGMENT_LENGTH;
+            dendrite.push_back({p, next, r, nextR});
+            p = next;
+            r = nextR;
+        }
+    }
+    return dendrites;
+}
+
+brayns::ModelDescriptorPtr createSDFModel(
+    brayns::Scene& scene, const std::vector<std::vector<Segment>>& dendrites)
+{
+    auto model = scene.createModel();
+    model->createMaterial(0, "sdf")->setDiffuseColor({1.f, 1.f, 1.f});
+
+    std::vector<brayns::uint64_ts> neighbours(1);
+    model->addSDFGeometry(0, brayns::createSDFSphere({0.f, 0.f, 0.f},
+                                                     SOMA_RADIUS),
+                          {});
+    for (const auto& dendrite : dendrites)
+        for (size_t i = 0; i < dendrite.size(); ++i)
+        {
+            const auto& segment = dendrite[i];
+            const uint64_t previous = i == 0 ? 0 : neighbours.size() - 1;
+            const uint64_t index = model->addSDFGeometry(
+                0, brayns::createSDFConePillSigmoid(segment.p0, segment.p1,
+                                                    segment.r0, segment.r1),
+                {});
+            neighbours.push_back({previous});
+            neighbours[previous].push_back(index);
+        }
+    for (size_t i = 0; i < neighbours.size(); ++i)
+        model->updateSDFGeometryNeighbours(i, neighbours[i]);
+
+    return std::make_shared<brayns::ModelDescriptor>(std::move(model), "SDF");
+}
+
+brayns::ModelDescriptorPtr createReferenceModel(
+    brayns::Scene& scene, const std::vector<std::vector<Segment>>& dendrites)
+{
+    auto model = scene.createModel();
+    model->createMaterial(0, "reference")->setDiffuseColor({1.f, 1.f, 1.f});
+
+    model->addSphere(0, {{0.f, 0.f, 0.f}, SOMA_RADIUS});
+    for (const auto& dendrite : dendrites)
+        for (const auto& segment : dendrite)
+        {
+            model->addCone(0, {segment.p0, segment.p1, segment.r0, segment.r1});
+            model->addSphere(0, {segment.p1, segment.r1});
+        }
+    return std::make_shared<brayns::ModelDescriptor>(std::move(model),
+                                                     "Reference");
+}
+
+// The background is pure red, the geometry is white and hence never red
+bool isBackground(const uint8_t* pixel)
+{
+    return pixel[0] == 255 && pixel[1] == 0 && pixel[2] == 0;
+}
+
+uint64_t render(brayns::Brayns& brayns, brayns::uint8_ts& image)
+{
+    brayns.commit();
+
+    brayns::Timer timer;
+    timer.start();
+    brayns.render();
+    timer.stop();
+
+    auto& frameBuffer = brayns.getEngine().getFrameBuffer();
+    frameBuffer.map();
+    const auto size = frameBuffer.getSize();
+    const auto colors = frameBuffer.getColorBuffer();
+    image.assign(colors,
+                 colors + size.x * size.y * frameBuffer.getColorDepth());
+    frameBuffer.unmap();
+    return timer.milliseconds();
+}
+} // namespace
+
+TEST_CASE("sdf_morphology_benchmark")
+{
+    std::vector<const char*> argv = {
+        {"sdfMorphology", "--disable-accumulation", "--window-size", "1024",
+         "1024", "--background-color", "1", "0", "0"}};
+    brayns::Brayns brayns(argv.size(), argv.data());
+
+    auto& scene = brayns.getEngine().getScene();
+    const auto dendrites = createMorphology();
+    const auto sdfModel = createSDFModel(scene, dendrites);
+    const auto referenceModel = createReferenceModel(scene, dendrites);
+    brayns.getEngine().getCamera().setPosition({0., 0., 150.});
+
+    const auto referenceId = scene.addModel(referenceModel);
+    brayns::uint8_ts reference;
+    render(brayns, reference);
+    scene.removeModel(referenceId);
+
+    scene.addModel(sdfModel);
+    brayns::uint8_ts image;
+    const auto sdfTime = render(brayns, image);
+
+    REQUIRE_EQ(image.size(), reference.size());
+    const size_t depth = image.size() / (1024 * 1024);
+    size_t holes = 0;
+    size_t covered = 0;
+    for (size_t i = 0; i < image.size(); i += depth)
+    {
+        if (isBackground(&reference[i]))
+            continue;
+        ++covered;
+        if (isBackground(&image[i]))
+            ++holes;
+    }
+
+    std::cout << "SDF rendering: " << sdfTime << " ms" << std::endl;
+    std::cout << "Holes: " << holes << " of " << covered << " pixels"
+              << std::endl;
+    CHECK_LT(holes, covered / 1000);
+}
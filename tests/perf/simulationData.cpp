@@ -0,0 +1,209 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/Brayns.h>
+
+#include <brayns/common/Timer.h>
+#include <brayns/common/simulation/AbstractSimulationHandler.h>
+#include <brayns/engineapi/Engine.h>
+#include <brayns/engineapi/Model.h>
+#include <brayns/engineapi/Scene.h>
+#include <brayns/parameters/ParametersManager.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+std::atomic_size_t allocations{0};
+} // namespace
+
+void* operator new(const size_t size)
+{
+    ++allocations;
+    if (void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+const uint64_t FRAME_SIZE = 50000000;
+const uint32_t NB_FRAMES = 100;
+
+/**
+ * Alternates between two prepared frames, so no time is spent loading. The
+ * values are copied into the model's simulation data buffer.
+ */
+class SyntheticSimulationHandler : public brayns::AbstractSimulationHandler
+{
+public:
+    SyntheticSimulationHandler()
+        : _frames{{brayns::floats(FRAME_SIZE, -80.f),
+                   brayns::floats(FRAME_SIZE, -10.f)}}
+    {
+        _nbFrames = NB_FRAMES;
+        _frameSize = FRAME_SIZE;
+        _dt = 0.1;
+    }
+
+    void* getFrameData(const uint32_t frame) final
+    {
+        _currentFrame = _getBoundedFrame(frame);
+        return _frames[_currentFrame % 2].data();
+    }
+
+    brayns::AbstractSimulationHandlerPtr clone() const final
+    {
+        return std::make_shared<SyntheticSimulationHandler>(*this);
+    }
+
+private:
+    std::array<brayns::floats, 2> _frames;
+};
+
+/**
+ * Pretends to load each frame into _frameData, like the report handlers do,
+ * and hands it over to the model instead of copying. The values are not
+ * rewritten, so no time is spent loading either.
+ */
+class HandOverSimulationHandler : public brayns::AbstractSimulationHandler
+{
+public:
+    HandOverSimulationHandler()
+    {
+        _nbFrames = NB_FRAMES;
+        _frameSize = FRAME_SIZE;
+        _dt = 0.1;
+        _frameData.resize(FRAME_SIZE, -80.f);
+    }
+
+    void* getFrameData(const uint32_t frame) final
+    {
+        const auto boundedFrame = _getBoundedFrame(frame);
+        if (boundedFrame == _currentFrame)
+            return _getFrameData();
+
+        // reuses the memory handed back by the model after the first frames
+        _frameData.resize(FRAME_SIZE);
+        _handedOverFrameData = nullptr;
+        _currentFrame = boundedFrame;
+        return _frameData.data();
+    }
+
+    bool takeFrameData(const uint32_t frame, brayns::floats& buffer) final
+    {
+        return _handOverFrameData(frame, buffer);
+    }
+
+    brayns::AbstractSimulationHandlerPtr clone() const final
+    {
+        return std::make_shared<HandOverSimulationHandler>(*this);
+    }
+};
+
+struct FrameSwitchTimes
+{
+    uint64_t average{0};
+    uint64_t slowest{0};
+    size_t allocations{0};
+};
+
+FrameSwitchTimes benchmarkFrameSwitch(
+    brayns::Brayns& brayns, brayns::AbstractSimulationHandlerPtr handler)
+{
+    auto& scene = brayns.getEngine().getScene();
+    auto model = scene.createModel();
+    model->createMaterial(0, "cells");
+    model->addSphere(0, {{0, 0, 0}, 1.f, 0});
+    model->setSimulationHandler(handler);
+    auto& simulatedModel = *model;
+    const auto modelID = scene.addModel(
+        std::make_shared<brayns::ModelDescriptor>(std::move(model), "cells"));
+    brayns.commit();
+
+    auto& animationParams =
+        brayns.getParametersManager().getAnimationParameters();
+
+    brayns::Timer timer;
+    FrameSwitchTimes times;
+    uint64_t total = 0;
+    for (uint32_t frame = 0; frame < NB_FRAMES; ++frame)
+    {
+        animationParams.setFrame(frame);
+        const size_t allocationsBefore = allocations;
+        timer.start();
+        CHECK(simulatedModel.commitSimulationData());
+        timer.stop();
+        // The first two frames create the front and back buffers
+        if (frame >= 2)
+            times.allocations += allocations - allocationsBefore;
+        total += timer.microseconds();
+        times.slowest = std::max(times.slowest, uint64_t(timer.microseconds()));
+    }
+    times.average = total / NB_FRAMES;
+
+    scene.removeModel(modelID);
+    brayns.commit();
+    return times;
+}
+} // namespace
+
+TEST_CASE("simulation_frame_switch_benchmark")
+{
+    const char* argv[] = {"brayns"};
+    brayns::Brayns brayns(1, argv);
+
+    // baseline: the values are copied into the back buffer on each switch
+    const auto copied =
+        benchmarkFrameSwitch(brayns,
+                             std::make_shared<SyntheticSimulationHandler>());
+    const auto handedOver =
+        benchmarkFrameSwitch(brayns,
+                             std::make_shared<HandOverSimulationHandler>());
+
+    std::cout << "Frame switch of " << FRAME_SIZE << " values, copied: "
+              << copied.average << " us on average, " << copied.slowest
+              << " us at most, " << copied.allocations
+              << " allocations during playback" << std::endl;
+    std::cout << "Frame switch of " << FRAME_SIZE << " values, handed over: "
+              << handedOver.average << " us on average, " << handedOver.slowest
+              << " us at most, " << handedOver.allocations
+              << " allocations during playback" << std::endl;
+
+    // Only the shared memory mode reuses the data objects, the replicated mode
+    // creates one per frame. Handed over frames live in changing memory, so
+    // they need a new data object, but no copy of the values.
+    if (brayns.getParametersManager()
+            .getGeometryParameters()
+            .getMemoryMode() == brayns::MemoryMode::shared)
+    {
+        CHECK_EQ(copied.allocations, 0);
+    }
+}
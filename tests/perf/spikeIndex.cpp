@@ -0,0 +1,82 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "../../plugins/CircuitExplorer/plugin/io/SpikeIndex.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+namespace
+{
+const size_t NB_CELLS = 1000000;
+const size_t NB_SPIKES = 100000000;
+const float END_TIME = 10000.f;
+const float DT = 0.01f;
+const size_t NB_RANDOM_FRAMES = 100;
+
+using Spike = std::pair<float, uint32_t>;
+
+float elapsedMs(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<float, std::milli>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+} // namespace
+
+TEST_CASE("spike_index_random_access_benchmark")
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32_t> cells(0, NB_CELLS - 1);
+    std::vector<Spike> spikes(NB_SPIKES);
+    for (size_t i = 0; i < NB_SPIKES; ++i)
+        spikes[i] = {END_TIME * i / NB_SPIKES, cells(rng)};
+
+    auto start = std::chrono::steady_clock::now();
+    const SpikeIndex index(NB_CELLS, spikes,
+                           [](const Spike& spike) -> size_t {
+                               return spike.second;
+                           },
+                           [](const Spike& spike) { return spike.first; });
+    std::cout << "Index of " << index.getNbSpikes() << " spikes built in "
+              << elapsedMs(start) << " ms" << std::endl;
+    CHECK_EQ(index.getNbSpikes(), NB_SPIKES);
+
+    spikes.clear();
+    spikes.shrink_to_fit();
+
+    const SpikeIndex::Values values{-80.f, -1.f, 1.f};
+    std::vector<float> frameData(NB_CELLS);
+    const uint32_t nbFrames = END_TIME / DT;
+    std::uniform_int_distribution<uint32_t> frames(0, nbFrames - 1);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < NB_RANDOM_FRAMES; ++i)
+    {
+        const auto frame = frames(rng);
+        const float ts = frame * DT;
+        index.computeFrame(ts, ts + 1.f, frame, DT, values, frameData.data());
+    }
+    std::cout << "Random frame access: " << elapsedMs(start) / NB_RANDOM_FRAMES
+              << " ms per frame of " << NB_CELLS << " cells" << std::endl;
+}
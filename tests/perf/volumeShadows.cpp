@@ -0,0 +1,400 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <brayns/common/Timer.h>
+#include <brayns/common/types.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+
+// Compares the volume shadow rays of CircuitExplorerAdvancedRenderer.ispc, on
+// the CPU and for the same shading points of a dense volume: the former back
+// to front marching with a fixed step, the front to back marching with
+// adaptive steps, empty space skipping and early termination, and the lookup
+// in a shadow grid precomputed with the front to back marching.
+
+namespace
+{
+const int32_t VOLUME_SIZE = 256;
+const float SPHERE_RADIUS = 112.f;
+const int32_t IMAGE_SIZE = 128;
+
+// Like the renderer and brayns::MACRO_CELL_SIZE
+const float SAMPLING_STEP = 1.f;
+const float SAMPLING_THRESHOLD = 0.001f;
+const float MAX_SHADOW_STEP_FACTOR = 4.f;
+const int32_t MACRO_CELL_SIZE = 16;
+const int32_t SHADOW_GRID_CELL_SIZE = 4;
+
+// Transfer function opacity of a voxel value
+const float MAX_OPACITY = 0.05f;
+
+float getOpacity(const float value)
+{
+    return MAX_OPACITY * value;
+}
+
+/**
+ * A dense sphere, so that every shadow ray crosses a long semi-transparent
+ * path, with the macro cells of the renderer.
+ */
+class Volume
+{
+public:
+    Volume()
+        : _voxels(VOLUME_SIZE * VOLUME_SIZE * VOLUME_SIZE, 0.f)
+    {
+        const brayns::Vector3f center(VOLUME_SIZE / 2.f);
+        for (int32_t z = 0; z < VOLUME_SIZE; ++z)
+            for (int32_t y = 0; y < VOLUME_SIZE; ++y)
+                for (int32_t x = 0; x < VOLUME_SIZE; ++x)
+                {
+                    const float distance =
+                        glm::length(brayns::Vector3f(x, y, z) - center);
+                    if (distance < SPHERE_RADIUS)
+                        _voxels[_index(x, y, z)] =
+                            1.f - distance / SPHERE_RADIUS;
+                }
+
+        // The cells overlap by one voxel for the trilinear interpolation
+        _nbMacroCells = (VOLUME_SIZE + MACRO_CELL_SIZE - 1) / MACRO_CELL_SIZE;
+        _emptyMacroCells.resize(_nbMacroCells * _nbMacroCells * _nbMacroCells);
+        for (int32_t z = 0; z < _nbMacroCells; ++z)
+            for (int32_t y = 0; y < _nbMacroCells; ++y)
+                for (int32_t x = 0; x < _nbMacroCells; ++x)
+                {
+                    float maxValue = 0.f;
+                    for (int32_t k = 0; k <= MACRO_CELL_SIZE; ++k)
+                        for (int32_t j = 0; j <= MACRO_CELL_SIZE; ++j)
+                            for (int32_t i = 0; i <= MACRO_CELL_SIZE; ++i)
+                                maxValue = std::max(
+                                    maxValue,
+                                    _voxel(x * MACRO_CELL_SIZE + i,
+                                           y * MACRO_CELL_SIZE + j,
+                                           z * MACRO_CELL_SIZE + k));
+                    _emptyMacroCells[(z * _nbMacroCells + y) * _nbMacroCells +
+                                     x] =
+                        getOpacity(maxValue) <= SAMPLING_THRESHOLD;
+                }
+    }
+
+    // Trilinear interpolation of the voxels, clamped to the volume
+    float sample(const brayns::Vector3f& point) const
+    {
+        const float upper = VOLUME_SIZE - 1;
+        const brayns::Vector3f p(std::min(std::max(point.x, 0.f), upper),
+                                 std::min(std::max(point.y, 0.f), upper),
+                                 std::min(std::max(point.z, 0.f), upper));
+        const int32_t x = std::min(int32_t(p.x), VOLUME_SIZE - 2);
+        const int32_t y = std::min(int32_t(p.y), VOLUME_SIZE - 2);
+        const int32_t z = std::min(int32_t(p.z), VOLUME_SIZE - 2);
+        const brayns::Vector3f f = p - brayns::Vector3f(x, y, z);
+        const auto lerp = [](const float t, const float a, const float b) {
+            return a + t * (b - a);
+        };
+        const float v00 =
+            lerp(f.x, _voxels[_index(x, y, z)], _voxels[_index(x + 1, y, z)]);
+        const float v10 = lerp(f.x, _voxels[_index(x, y + 1, z)],
+                               _voxels[_index(x + 1, y + 1, z)]);
+        const float v01 = lerp(f.x, _voxels[_index(x, y, z + 1)],
+                               _voxels[_index(x + 1, y, z + 1)]);
+        const float v11 = lerp(f.x, _voxels[_index(x, y + 1, z + 1)],
+                               _voxels[_index(x + 1, y + 1, z + 1)]);
+        return lerp(f.z, lerp(f.y, v00, v10), lerp(f.y, v01, v11));
+    }
+
+    // Distances at which a ray enters and leaves the volume
+    static void intersect(const brayns::Vector3f& origin,
+                          const brayns::Vector3f& direction, float& t0,
+                          float& t1)
+    {
+        t0 = -std::numeric_limits<float>::infinity();
+        t1 = std::numeric_limits<float>::infinity();
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (direction[i] == 0.f)
+                continue;
+            const float lower = -origin[i] / direction[i];
+            const float upper = (VOLUME_SIZE - 1 - origin[i]) / direction[i];
+            t0 = std::max(t0, std::min(lower, upper));
+            t1 = std::min(t1, std::max(lower, upper));
+        }
+    }
+
+    // Like getEmptySpaceExit() of the renderer
+    float getEmptySpaceExit(const brayns::Vector3f& origin,
+                            const brayns::Vector3f& direction,
+                            const float t) const
+    {
+        const brayns::Vector3f point = origin + t * direction;
+        int32_t cell[3];
+        for (size_t i = 0; i < 3; ++i)
+            cell[i] = std::min(std::max(int32_t(std::floor(point[i] /
+                                                           MACRO_CELL_SIZE)),
+                                        0),
+                               _nbMacroCells - 1);
+        if (!_emptyMacroCells[(cell[2] * _nbMacroCells + cell[1]) *
+                                  _nbMacroCells +
+                              cell[0]])
+            return t;
+
+        float exit = std::numeric_limits<float>::infinity();
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (direction[i] == 0.f)
+                continue;
+            const float lower = cell[i] * MACRO_CELL_SIZE;
+            const float upper = lower + MACRO_CELL_SIZE;
+            exit = std::min(exit, ((direction[i] > 0.f ? upper : lower) -
+                                   origin[i]) /
+                                      direction[i]);
+        }
+        return exit;
+    }
+
+private:
+    std::vector<float> _voxels;
+    std::vector<uint8_t> _emptyMacroCells;
+    int32_t _nbMacroCells{0};
+
+    static size_t _index(const int32_t x, const int32_t y, const int32_t z)
+    {
+        return (size_t(z) * VOLUME_SIZE + y) * VOLUME_SIZE + x;
+    }
+
+    float _voxel(const int32_t x, const int32_t y, const int32_t z) const
+    {
+        if (x >= VOLUME_SIZE || y >= VOLUME_SIZE || z >= VOLUME_SIZE)
+            return 0.f;
+        return _voxels[_index(x, y, z)];
+    }
+};
+
+// The former shadow rays: from where the ray leaves the volume back to the
+// shading point, with a step of samplingStep / samplingRate
+float marchBackToFront(const Volume& volume, const brayns::Vector3f& origin,
+                       const brayns::Vector3f& direction,
+                       const float samplingRate)
+{
+    float t0, t1;
+    Volume::intersect(origin, direction, t0, t1);
+
+    float shadowIntensity = 0.f;
+    const float epsilon = SAMPLING_STEP / samplingRate;
+    for (float t = t1; t > epsilon && shadowIntensity < 1.f; t -= epsilon)
+        shadowIntensity += getOpacity(volume.sample(origin + direction * t));
+    return shadowIntensity;
+}
+
+// Like marchVolumeShadow() of the renderer
+float marchFrontToBack(const Volume& volume, const brayns::Vector3f& origin,
+                       const brayns::Vector3f& direction,
+                       const float samplingRate)
+{
+    float t0, t1;
+    Volume::intersect(origin, direction, t0, t1);
+
+    const float referenceStep = SAMPLING_STEP / samplingRate;
+    const float minStep = referenceStep;
+    const float maxStep = MAX_SHADOW_STEP_FACTOR * referenceStep;
+
+    float shadowIntensity = 0.f;
+    float step = minStep;
+    float t = std::max(t0, 0.f);
+    while (t < t1 && shadowIntensity < 1.f)
+    {
+        const float emptySpaceExit =
+            volume.getEmptySpaceExit(origin, direction, t);
+        if (emptySpaceExit > t)
+        {
+            t = emptySpaceExit + 0.01f * minStep;
+            continue;
+        }
+
+        const float opacity = getOpacity(volume.sample(origin + direction * t));
+        step = opacity > SAMPLING_THRESHOLD ? minStep
+                                            : std::min(2.f * step, maxStep);
+        shadowIntensity += opacity * step / referenceStep;
+        t += step;
+    }
+    return shadowIntensity;
+}
+
+// Like the shadow grids of the renderer: one point every SHADOW_GRID_CELL_SIZE
+// voxels, marched front to back towards the light
+class ShadowGrid
+{
+public:
+    ShadowGrid(const Volume& volume, const brayns::Vector3f& lightDirection,
+               const float samplingRate)
+        : _size((VOLUME_SIZE + SHADOW_GRID_CELL_SIZE - 2) /
+                    SHADOW_GRID_CELL_SIZE +
+                1)
+        , _values(size_t(_size) * _size * _size)
+    {
+#pragma omp parallel for
+        for (int32_t z = 0; z < _size; ++z)
+            for (int32_t y = 0; y < _size; ++y)
+                for (int32_t x = 0; x < _size; ++x)
+                {
+                    const brayns::Vector3f point =
+                        brayns::Vector3f(x, y, z) *
+                        float(SHADOW_GRID_CELL_SIZE);
+                    _values[(size_t(z) * _size + y) * _size + x] =
+                        std::min(1.f, marchFrontToBack(volume, point,
+                                                       lightDirection,
+                                                       samplingRate));
+                }
+    }
+
+    // Like getShadowGridValue() of the renderer
+    float getValue(const brayns::Vector3f& point) const
+    {
+        const brayns::Vector3f p = point / float(SHADOW_GRID_CELL_SIZE);
+        const int32_t x = std::min(int32_t(p.x), _size - 2);
+        const int32_t y = std::min(int32_t(p.y), _size - 2);
+        const int32_t z = std::min(int32_t(p.z), _size - 2);
+        const brayns::Vector3f f = p - brayns::Vector3f(x, y, z);
+        const size_t dy = _size;
+        const size_t dz = size_t(_size) * _size;
+        const size_t index = z * dz + y * dy + x;
+        const auto lerp = [](const float t, const float a, const float b) {
+            return a + t * (b - a);
+        };
+        const float v00 = lerp(f.x, _values[index], _values[index + 1]);
+        const float v10 =
+            lerp(f.x, _values[index + dy], _values[index + dy + 1]);
+        const float v01 =
+            lerp(f.x, _values[index + dz], _values[index + dz + 1]);
+        const float v11 =
+            lerp(f.x, _values[index + dz + dy], _values[index + dz + dy + 1]);
+        return lerp(f.z, lerp(f.y, v00, v10), lerp(f.y, v01, v11));
+    }
+
+private:
+    int32_t _size;
+    std::vector<float> _values;
+};
+
+// The samples of orthographic primary rays along -z which get shaded, until
+// the rays are opaque
+brayns::Vector3fs getShadingPoints(const Volume& volume,
+                                   const float samplingRate)
+{
+    const float step = SAMPLING_STEP / samplingRate;
+    const float pixelSize = float(VOLUME_SIZE - 1) / IMAGE_SIZE;
+    brayns::Vector3fs points;
+    for (int32_t y = 0; y < IMAGE_SIZE; ++y)
+        for (int32_t x = 0; x < IMAGE_SIZE; ++x)
+        {
+            float alpha = 0.f;
+            for (float z = VOLUME_SIZE - 1; z >= 0.f && alpha < 1.f; z -= step)
+            {
+                const brayns::Vector3f point((x + 0.5f) * pixelSize,
+                                             (y + 0.5f) * pixelSize, z);
+                const float opacity = getOpacity(volume.sample(point));
+                if (opacity <= SAMPLING_THRESHOLD)
+                    continue;
+                points.push_back(point);
+                alpha += opacity;
+            }
+        }
+    return points;
+}
+
+struct Shadows
+{
+    uint64_t milliseconds{0};
+    brayns::floats values;
+};
+
+template <typename ShadowFunction>
+Shadows computeShadows(const brayns::Vector3fs& points,
+                       const ShadowFunction& shadowFunction)
+{
+    Shadows shadows;
+    shadows.values.resize(points.size());
+    brayns::Timer timer;
+    timer.start();
+#pragma omp parallel for
+    for (int64_t i = 0; i < int64_t(points.size()); ++i)
+        shadows.values[i] = std::min(1.f, shadowFunction(points[i]));
+    timer.stop();
+    shadows.milliseconds = timer.milliseconds();
+    return shadows;
+}
+
+float getMeanDifference(const Shadows& shadows, const Shadows& reference)
+{
+    double sum = 0.;
+    for (size_t i = 0; i < shadows.values.size(); ++i)
+        sum += std::abs(shadows.values[i] - reference.values[i]);
+    return sum / std::max<size_t>(1, shadows.values.size());
+}
+} // namespace
+
+TEST_CASE("volume_shadows_benchmark")
+{
+    const Volume volume;
+    const brayns::Vector3f lightDirection =
+        glm::normalize(brayns::Vector3f(1.f, 1.f, 1.f));
+
+    for (const float samplingRate : {1.f, 0.125f})
+    {
+        const auto points = getShadingPoints(volume, samplingRate);
+
+        const auto backToFront =
+            computeShadows(points, [&](const brayns::Vector3f& point) {
+                return marchBackToFront(volume, point, lightDirection,
+                                        samplingRate);
+            });
+        const auto frontToBack =
+            computeShadows(points, [&](const brayns::Vector3f& point) {
+                return marchFrontToBack(volume, point, lightDirection,
+                                        samplingRate);
+            });
+
+        brayns::Timer timer;
+        timer.start();
+        const ShadowGrid grid(volume, lightDirection, samplingRate);
+        timer.stop();
+        const auto gridLookup =
+            computeShadows(points, [&](const brayns::Vector3f& point) {
+                return grid.getValue(point);
+            });
+
+        std::cout << "Sampling rate " << samplingRate << ", " << points.size()
+                  << " shading points" << std::endl;
+        std::cout << "  back to front: " << backToFront.milliseconds << " ms"
+                  << std::endl;
+        std::cout << "  front to back: " << frontToBack.milliseconds
+                  << " ms, mean difference "
+                  << getMeanDifference(frontToBack, backToFront) << std::endl;
+        std::cout << "  shadow grid: " << gridLookup.milliseconds << " ms + "
+                  << timer.milliseconds() << " ms to compute the grid, mean "
+                  << "difference " << getMeanDifference(gridLookup, backToFront)
+                  << std::endl;
+    }
+}
@@ -25,6 +25,19 @@
 using Vec2 = std::array<unsigned, 2>;
 const Vec2 vecVal{{1, 1}};
 
+struct Attached
+{
+    std::string chunksID;
+};
+
+namespace staticjson
+{
+inline void init(Attached* a, ObjectHandler* h)
+{
+    h->add_property("chunks_id", &a->chunksID);
+}
+} // namespace staticjson
+
 TEST_CASE("plugin_actions")
 {
     ClientServer clientServer({"--plugin", "myPlugin"});
@@ -54,6 +67,15 @@ TEST_CASE("plugin_actions")
     CHECK_EQ(makeRequest<std::string>("who"), "me");
     CHECK((makeRequest<Vec2, Vec2>("echo", vecVal) == vecVal));
 
+    brayns::Chunk chunk;
+    chunk.id = "vec";
+    chunk.attachment = true;
+    makeNotification("chunk", chunk);
+    clientServer.getWsClient().sendBinary(
+        reinterpret_cast<const char*>(vecVal.data()), sizeof(Vec2));
+    clientServer.process();
+    makeNotification("attached", Attached{"vec"});
+
     clientServer.getBrayns()
         .getParametersManager()
         .getRenderingParameters()
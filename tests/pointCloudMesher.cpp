@@ -0,0 +1,87 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include "../plugins/CircuitExplorer/plugin/meshing/PointCloudMesher.h"
+
+#include <random>
+
+namespace
+{
+const size_t NB_CLOUDS = 200;
+const size_t NB_INNER_POINTS = 1000;
+
+/**
+ * Synthetic point clouds: the corners of a box around random points inside
+ * it, so each hull is the box, which triangulated has 18 edges.
+ */
+PointCloud syntheticPointClouds()
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> inside(0.1f, 0.9f);
+
+    PointCloud pointCloud;
+    for (size_t i = 0; i < NB_CLOUDS; ++i)
+    {
+        auto& points = pointCloud[i];
+        const float offset = i;
+        for (size_t j = 0; j < NB_INNER_POINTS; ++j)
+            points.push_back(
+                {offset + inside(rng), inside(rng), inside(rng), 1.f});
+        for (size_t corner = 0; corner < 8; ++corner)
+            points.push_back({offset + (corner & 1), float((corner >> 1) & 1),
+                              float((corner >> 2) & 1), 1.f});
+    }
+
+    // a flat point cloud has no hull
+    pointCloud[NB_CLOUDS] = {{0.f, 0.f, 0.f, 1.f},
+                             {1.f, 0.f, 0.f, 1.f},
+                             {0.f, 1.f, 0.f, 1.f}};
+    return pointCloud;
+}
+} // namespace
+
+TEST_CASE("convex_hulls")
+{
+    PointCloudMesher mesher;
+    const auto hulls = mesher.computeConvexHulls(syntheticPointClouds());
+
+#if (CIRCUITEXPLORER_USE_CGAL)
+    REQUIRE_EQ(hulls.size(), NB_CLOUDS);
+    for (const auto& hull : hulls)
+    {
+        CHECK_EQ(hull.second.size(), 18u);
+        const float offset = hull.first;
+        for (const auto& edge : hull.second)
+        {
+            for (const auto& point : {edge.center, edge.up})
+            {
+                CHECK_GE(point.x, offset);
+                CHECK_LE(point.x, offset + 1.f);
+                CHECK((point.y == 0.f || point.y == 1.f ||
+                       point.z == 0.f || point.z == 1.f));
+            }
+        }
+    }
+#else
+    CHECK(hulls.empty());
+#endif
+}
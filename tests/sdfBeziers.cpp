@@ -41,3 +41,56 @@ TEST_CASE("bezier_bounding_box")
     CHECK_EQ(bbox.getMin(), brayns::Vector3d(-3.0, -1.0, -1.0));
     CHECK_EQ(bbox.getMax(), brayns::Vector3d(2.0, 1.0, 1.0));
 }
+
+TEST_CASE("bezier_subdivision")
+{
+    const brayns::SDFBezier bezier = {
+        0,                   // userdata
+        {0.0f, 0.0f, 0.0f},  // p0
+        {0.0f, 4.0f, 0.0f},  // c0
+        0.2f,                // r0
+        {4.0f, 0.0f, 0.0f},  // p1
+        {4.0f, 4.0f, 0.0f},  // c1
+        0.1f                 // r1
+    };
+
+    brayns::SDFBeziers pieces;
+    subdivideBezier(bezier, 0.1f, pieces);
+    REQUIRE_GT(pieces.size(), 1u);
+
+    // pieces are connected, follow the curve and interpolate the radius
+    CHECK_EQ(pieces.front().p0, bezier.p0);
+    CHECK_EQ(pieces.back().p1, bezier.p1);
+    CHECK_EQ(pieces.front().r0, bezier.r0);
+    CHECK_EQ(pieces.back().r1, bezier.r1);
+    for (size_t i = 1; i < pieces.size(); ++i)
+    {
+        CHECK_EQ(pieces[i].p0, pieces[i - 1].p1);
+        CHECK_EQ(pieces[i].r0, pieces[i - 1].r1);
+    }
+
+    const auto& mid = pieces[pieces.size() / 2].p0;
+    CHECK_EQ(mid.x, doctest::Approx(brayns::bezier(0.5f, 0, 0, 4, 4)));
+    CHECK_EQ(mid.y, doctest::Approx(brayns::bezier(0.5f, 0, 4, 0, 4)));
+
+    // the pieces are tighter than the bounds of the whole curve
+    const auto volume = [](const brayns::Boxd& box) {
+        const auto size = box.getSize();
+        return size.x * size.y * size.z;
+    };
+    double piecesVolume = 0;
+    for (const auto& piece : pieces)
+    {
+        CHECK_LE(bezierFlatness(piece), 0.1f);
+        piecesVolume += volume(bezierBounds(piece));
+    }
+    CHECK_LT(piecesVolume, volume(bezierBounds(bezier)));
+
+    // straight curves are not split
+    const brayns::SDFBezier line = {0,   {0.f, 0.f, 0.f}, {1.f, 0.f, 0.f},
+                                    1.f, {3.f, 0.f, 0.f}, {2.f, 0.f, 0.f},
+                                    1.f};
+    pieces.clear();
+    subdivideBezier(line, 0.1f, pieces);
+    CHECK_EQ(pieces.size(), 1u);
+}
@@ -27,6 +27,36 @@
 
 #include "tests/PDiffHelpers.h"
 
+#include <cstdio>
+
+namespace
+{
+/** Collects the notifications about written snapshot files. */
+class WrittenFiles
+{
+public:
+    WrittenFiles()
+    {
+        getJsonRpcClient().connect<brayns::SnapshotFile>(
+            "snapshot-written", [this](const brayns::SnapshotFile& file) {
+                _files.push_back(file);
+            });
+    }
+
+    /** @return the files notified until numFiles arrived or a timeout. */
+    const std::vector<brayns::SnapshotFile>& wait(const size_t numFiles)
+    {
+        for (size_t attempts = 0; attempts != 100 && _files.size() < numFiles;
+             ++attempts)
+            process();
+        return _files;
+    }
+
+private:
+    std::vector<brayns::SnapshotFile> _files;
+};
+} // namespace
+
 TEST_CASE_FIXTURE(ClientServer, "snapshot")
 {
     brayns::SnapshotParams params;
@@ -89,3 +119,187 @@ TEST_CASE_FIXTURE(ClientServer, "snapshot_illegal_format")
                      brayns::ImageGenerator::ImageBase64>("snapshot", params)),
         rockets::jsonrpc::response_error);
 }
+
+TEST_CASE_FIXTURE(ClientServer, "snapshot_tiled")
+{
+    const std::string filePath = "/tmp/brayns_tiled_snapshot";
+    const std::string referencePath = "/tmp/brayns_untiled_snapshot";
+
+    brayns::SnapshotParams params;
+    params.size = {50, 40};
+    params.format = "tiff";
+    params.filePath = referencePath;
+
+    WrittenFiles writtenFiles;
+    makeRequest<brayns::SnapshotParams, brayns::ImageGenerator::ImageBase64>(
+        "snapshot", params);
+    params.tileSize = 16;
+    params.filePath = filePath;
+    makeRequest<brayns::SnapshotParams, brayns::ImageGenerator::ImageBase64>(
+        "snapshot", params);
+
+    const auto& files = writtenFiles.wait(2);
+    REQUIRE_EQ(files.size(), 2);
+    for (const auto& file : files)
+        CHECK(file.written);
+
+    const auto loadImage = [](const std::string& path) {
+        brayns::freeimage::ImagePtr image(
+            FreeImage_Load(FIF_TIFF, path.c_str()));
+        std::remove(path.c_str());
+        REQUIRE(image);
+        return createPDiffRGBAImage(
+            brayns::freeimage::ImagePtr(FreeImage_ConvertTo32Bits(image.get()))
+                .get());
+    };
+    const auto reference = loadImage(referencePath + ".tiff");
+    const auto tiled = loadImage(filePath + ".tiff");
+    CHECK_EQ(tiled->get_width(), 50u);
+    CHECK_EQ(tiled->get_height(), 40u);
+
+    // the tiles must assemble to the image rendered in one piece
+    std::string errorOutput;
+    CHECK_MESSAGE(pdiff::yee_compare(*reference, *tiled,
+                                     pdiff::PerceptualDiffParameters(),
+                                     nullptr, nullptr, &errorOutput, nullptr,
+                                     nullptr),
+                  errorOutput);
+}
+
+TEST_CASE_FIXTURE(ClientServer, "snapshot_tiled_not_streamable_format")
+{
+    brayns::SnapshotParams params;
+    params.size = {50, 40};
+    params.format = "png";
+    params.filePath = "/tmp/brayns_tiled_snapshot";
+    params.tileSize = 16;
+    CHECK_THROWS_AS(
+        (makeRequest<brayns::SnapshotParams,
+                     brayns::ImageGenerator::ImageBase64>("snapshot", params)),
+        rockets::jsonrpc::response_error);
+}
+
+TEST_CASE_FIXTURE(ClientServer, "snapshot_tiled_without_file_path")
+{
+    brayns::SnapshotParams params;
+    params.size = {50, 40};
+    params.format = "tiff";
+    params.tileSize = 16;
+    CHECK_THROWS_AS(
+        (makeRequest<brayns::SnapshotParams,
+                     brayns::ImageGenerator::ImageBase64>("snapshot", params)),
+        rockets::jsonrpc::response_error);
+}
+
+TEST_CASE_FIXTURE(ClientServer, "export_frames")
+{
+    brayns::ExportFramesParams params;
+    params.path = "/tmp";
+    params.size = {50, 40};
+    params.cameras = {{{0, 0, 5}, {1, 0, 0, 0}, {0, 0, 0}},
+                      {{0, 0, 10}, {1, 0, 0, 0}, {0, 0, 0}}};
+
+    auto result = makeRequest<brayns::ExportFramesParams,
+                              brayns::ExportFramesResult>("export-frames",
+                                                          params);
+    CHECK_EQ(result.framesWritten, 2u);
+    CHECK_EQ(result.framesSkipped, 0u);
+
+    // a resumed export does not render the existing frames again
+    params.resume = true;
+    result = makeRequest<brayns::ExportFramesParams,
+                         brayns::ExportFramesResult>("export-frames", params);
+    CHECK_EQ(result.framesWritten, 0u);
+    CHECK_EQ(result.framesSkipped, 2u);
+
+    for (const std::string filename : {"/tmp/00000.png", "/tmp/00001.png"})
+    {
+        brayns::freeimage::ImagePtr image(
+            FreeImage_Load(FIF_PNG, filename.c_str()));
+        REQUIRE(image);
+        CHECK_EQ(FreeImage_GetWidth(image.get()), 50u);
+        CHECK_EQ(FreeImage_GetHeight(image.get()), 40u);
+        std::remove(filename.c_str());
+    }
+}
+
+TEST_CASE_FIXTURE(ClientServer, "export_frames_mismatching_frames")
+{
+    brayns::ExportFramesParams params;
+    params.path = "/tmp";
+    params.size = {50, 40};
+    params.cameras = {{{0, 0, 5}, {1, 0, 0, 0}, {0, 0, 0}}};
+    params.animationFrames = {0, 1};
+    CHECK_THROWS_AS((makeRequest<brayns::ExportFramesParams,
+                                 brayns::ExportFramesResult>("export-frames",
+                                                             params)),
+                    rockets::jsonrpc::response_error);
+}
+
+TEST_CASE_FIXTURE(ClientServer, "snapshot_hdr_needs_float_format")
+{
+    brayns::SnapshotParams params;
+    params.size = {50, 40};
+    params.format = "png";
+    params.filePath = "/tmp/brayns_hdr_snapshot";
+    params.hdr = true;
+    CHECK_THROWS_AS(
+        (makeRequest<brayns::SnapshotParams,
+                     brayns::ImageGenerator::ImageBase64>("snapshot", params)),
+        rockets::jsonrpc::response_error);
+}
+
+TEST_CASE_FIXTURE(ClientServer, "snapshot_hdr_with_depth")
+{
+    brayns::SnapshotParams params;
+    params.size = {50, 40};
+    params.format = "tiff";
+    params.filePath = "/tmp/brayns_hdr_snapshot";
+    params.hdr = true;
+    params.depth = true;
+
+    // the files are written after the reply
+    WrittenFiles writtenFiles;
+    makeRequest<brayns::SnapshotParams, brayns::ImageGenerator::ImageBase64>(
+        "snapshot", params);
+    const auto& files = writtenFiles.wait(2);
+    REQUIRE_EQ(files.size(), 2);
+    CHECK(files[0].written);
+    CHECK(files[1].written);
+
+    const std::string colorFile = params.filePath + ".tiff";
+    brayns::freeimage::ImagePtr color(
+        FreeImage_Load(FIF_TIFF, colorFile.c_str()));
+    REQUIRE(color);
+    CHECK_EQ(FreeImage_GetImageType(color.get()), FIT_RGBAF);
+    CHECK_EQ(FreeImage_GetWidth(color.get()), 50u);
+    CHECK_EQ(FreeImage_GetHeight(color.get()), 40u);
+
+    const std::string depthFile = params.filePath + "_depth.tiff";
+    brayns::freeimage::ImagePtr depth(
+        FreeImage_Load(FIF_TIFF, depthFile.c_str()));
+    REQUIRE(depth);
+    CHECK_EQ(FreeImage_GetImageType(depth.get()), FIT_FLOAT);
+    CHECK_EQ(FreeImage_GetWidth(depth.get()), 50u);
+    CHECK_EQ(FreeImage_GetHeight(depth.get()), 40u);
+
+    std::remove(colorFile.c_str());
+    std::remove(depthFile.c_str());
+}
+
+TEST_CASE_FIXTURE(ClientServer, "snapshot_write_failure")
+{
+    brayns::SnapshotParams params;
+    params.size = {50, 40};
+    params.format = "png";
+    params.filePath = "/nonexistent/brayns_snapshot";
+
+    // the reply comes after rendering, the failure with the notification
+    WrittenFiles writtenFiles;
+    makeRequest<brayns::SnapshotParams, brayns::ImageGenerator::ImageBase64>(
+        "snapshot", params);
+    const auto& files = writtenFiles.wait(1);
+    REQUIRE_EQ(files.size(), 1);
+    CHECK_EQ(files[0].path, "/nonexistent/brayns_snapshot.png");
+    CHECK(!files[0].written);
+}
@@ -0,0 +1,69 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include "../plugins/CircuitExplorer/plugin/io/SpikeIndex.h"
+
+#include <vector>
+
+namespace
+{
+using Spike = std::pair<float, uint32_t>;
+
+const float DT = 0.1f;
+const SpikeIndex::Values VALUES{-80.f, -1.f, 10.f};
+} // namespace
+
+TEST_CASE("spike_index_compute_frame")
+{
+    // cell 0 never spikes, cell 1 spikes at frame 2, cell 2 at frames 1 and 5
+    const std::vector<Spike> spikes{{0.1f, 2}, {0.2f, 1}, {0.5f, 2}};
+    const SpikeIndex index(3, spikes,
+                           [](const Spike& spike) -> size_t {
+                               return spike.second;
+                           },
+                           [](const Spike& spike) { return spike.first; });
+    CHECK_EQ(index.getNbSpikes(), 3);
+
+    std::vector<float> data(3);
+    const auto computeFrame = [&](const uint32_t frame) {
+        const float start = frame * DT;
+        index.computeFrame(start, start + DT, frame, DT, VALUES, data.data());
+    };
+
+    computeFrame(2);
+    CHECK_EQ(data[0], VALUES.rest);
+    CHECK_EQ(data[1], VALUES.spiking);
+    CHECK_EQ(data[2], doctest::Approx(-11.f));
+
+    computeFrame(4);
+    CHECK_EQ(data[0], VALUES.rest);
+    CHECK_EQ(data[1], doctest::Approx(-21.f));
+    CHECK_EQ(data[2], doctest::Approx(-31.f));
+
+    computeFrame(5);
+    CHECK_EQ(data[2], VALUES.spiking);
+
+    // fully decayed
+    computeFrame(20);
+    CHECK_EQ(data[1], VALUES.rest);
+    CHECK_EQ(data[2], VALUES.rest);
+}
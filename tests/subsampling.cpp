@@ -59,3 +59,27 @@ TEST_CASE("no_subsampling_needed")
     CHECK_EQ(brayns.getEngine().getFrameBuffer().getSize(),
              brayns::Vector2ui(400, 200));
 }
+
+TEST_CASE("adaptive_subsampling")
+{
+    const char* argv[] = {"subsampling", "--window-size",       "400",
+                          "200",         "--target-frame-time", "0.0001",
+                          "demo"};
+    const int argc = sizeof(argv) / sizeof(char*);
+    brayns::Brayns brayns(argc, argv);
+
+    // the first frame has no measured render time yet
+    brayns.commitAndRender();
+    CHECK_EQ(brayns.getEngine().getFrameBuffer().getSize(),
+             brayns::Vector2ui(400, 200));
+
+    // any frame misses the target, hence the maximum subsampling
+    brayns.getEngine().getCamera().setPosition({0, 0, 5});
+    brayns.commitAndRender();
+    CHECK_EQ(brayns.getEngine().getFrameBuffer().getSize(),
+             brayns::Vector2ui(50, 25));
+
+    brayns.commitAndRender();
+    CHECK_EQ(brayns.getEngine().getFrameBuffer().getSize(),
+             brayns::Vector2ui(400, 200));
+}
@@ -0,0 +1,45 @@
+/* Copyright (c) 2019, EPFL/Blue Brain Project
+ * All rights reserved. Do not distribute without permission.
+ *
+ * This file is part of Brayns <https://github.com/BlueBrain/Brayns>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include "../plugins/CircuitExplorer/plugin/io/VoltageSimulationHandler.h"
+#include "StubReport.h"
+
+TEST_CASE("frame_cache")
+{
+    stubReport::write();
+    VoltageSimulationHandler handler(stubReport::PATH, stubReport::GIDS, true,
+                                     "/tmp", 2 * stubReport::FRAME_BYTES);
+    stubReport::checkFrameCache(handler);
+}
+
+TEST_CASE("clones_share_the_frame_cache")
+{
+    stubReport::write();
+    VoltageSimulationHandler handler(stubReport::PATH, stubReport::GIDS, true,
+                                     "/tmp", 2 * stubReport::FRAME_BYTES);
+    CHECK_EQ(stubReport::frameValue(handler, 3), 3.f);
+
+    auto clone = handler.clone();
+    CHECK_EQ(stubReport::frameValue(*clone, 2), 2.f);
+    CHECK_EQ(stubReport::frameValue(*clone, 3), 3.f);
+    CHECK_EQ(clone->getFrameCacheCounters().hits, 1);
+}
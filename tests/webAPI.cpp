@@ -21,8 +21,11 @@
 #include <jsonPropertyMap.h>
 
 #include "ClientServer.h"
+#include <ImageFrame.h>
 #include <brayns/engineapi/Renderer.h>
 
+#include <cstring>
+
 TEST_CASE_FIXTURE(ClientServer, "change_fov")
 {
     brayns::PropertyMap cameraParams;
@@ -72,3 +75,111 @@ TEST_CASE_FIXTURE(ClientServer, "schema")
     json.Parse(result.c_str());
     CHECK(json.HasMember("title"));
 }
+
+TEST_CASE_FIXTURE(ClientServer, "batch")
+{
+    rockets::ws::Client wsClient;
+    connect(wsClient);
+
+    std::string response;
+    wsClient.handleText([&response](const rockets::ws::Request& request)
+                            -> rockets::ws::Response {
+        // ignore the notifications of the scene changes
+        if (!request.message.empty() && request.message[0] == '[')
+            response = request.message;
+        return {};
+    });
+
+    REQUIRE(getScene().getClipPlanes().empty());
+    wsClient.sendText(
+        R"([{"jsonrpc":"2.0","id":1,"method":"add-clip-plane",)"
+        R"("params":[1,0,0,0]},)"
+        R"({"jsonrpc":"2.0","id":2,"method":"add-clip-plane",)"
+        R"("params":[0,1,0,0]},)"
+        R"({"jsonrpc":"2.0","id":3,"method":"add-clip-plane",)"
+        R"("params":[0,0,1,0]}])");
+
+    // The batch is one message, so all its requests are applied in the same
+    // commit and answered with one response
+    while (response.empty())
+    {
+        wsClient.process(CLIENT_PROCESS_TIMEOUT);
+        getBrayns().commit();
+        const auto numClipPlanes = getScene().getClipPlanes().size();
+        CHECK((numClipPlanes == 0 || numClipPlanes == 3));
+    }
+
+    using namespace rapidjson;
+    Document json;
+    json.Parse(response.c_str());
+    REQUIRE(json.IsArray());
+    CHECK_EQ(json.Size(), 3);
+    for (const auto& result : json.GetArray())
+        CHECK(result.HasMember("result"));
+
+    for (const auto& clipPlane : brayns::ClipPlanes(getScene().getClipPlanes()))
+        getScene().removeClipPlane(clipPlane->getID());
+}
+
+TEST_CASE_FIXTURE(ClientServer, "framed_image_stream")
+{
+    makeNotification<brayns::ImageStreamingMethod>("image-streaming-mode",
+                                                   {"stream", true, 2});
+    makeNotification<brayns::ImageAck>("image-ack", {1});
+
+    brayns::ImageFrameHeader header;
+    header.frameID = 42;
+    header.width = 64;
+    header.height = 32;
+    const uint8_t data[] = {1, 2, 3};
+    const auto frame = brayns::packImageFrame(header, data, sizeof(data));
+    REQUIRE_EQ(frame.size(), brayns::ImageFrameHeader::SIZE + sizeof(data));
+
+    uint32_t magic;
+    memcpy(&magic, frame.data(), sizeof(magic));
+    CHECK_EQ(magic, brayns::ImageFrameHeader::MAGIC);
+    uint64_t frameID;
+    memcpy(&frameID, frame.data() + 8, sizeof(frameID));
+    CHECK_EQ(frameID, 42);
+    CHECK_EQ(frame[brayns::ImageFrameHeader::SIZE + 2], 3);
+
+    const auto cameraHash = brayns::hashCamera(getCamera());
+    CHECK_EQ(cameraHash, brayns::hashCamera(getCamera()));
+    const auto position = getCamera().getPosition();
+    getCamera().setPosition(position + brayns::Vector3d(1, 0, 0));
+    CHECK_NE(cameraHash, brayns::hashCamera(getCamera()));
+    getCamera().setPosition(position);
+
+    makeNotification<brayns::ImageStreamingMethod>("image-streaming-mode",
+                                                   {"stream"});
+}
+
+TEST_CASE("image_frame_throttle")
+{
+    brayns::ImageFrameThrottle throttle;
+    CHECK(!throttle.isBlocked());
+
+    throttle.setMaxPendingFrames(2);
+    CHECK(!throttle.isBlocked());
+    CHECK_EQ(throttle.nextFrameID(), 1);
+    CHECK(!throttle.isBlocked());
+    CHECK_EQ(throttle.nextFrameID(), 2);
+
+    // two unacknowledged frames, skip until the next acknowledgement
+    CHECK(throttle.isBlocked());
+    CHECK(throttle.isBlocked());
+    CHECK(throttle.acknowledge(1));
+    CHECK(!throttle.isBlocked());
+    CHECK_EQ(throttle.nextFrameID(), 3);
+    CHECK(throttle.isBlocked());
+
+    // frames which were not sent yet cannot be acknowledged
+    CHECK(!throttle.acknowledge(42));
+    CHECK(throttle.isBlocked());
+
+    // outdated acknowledgements do not release pending frames
+    CHECK(!throttle.acknowledge(1));
+    CHECK(throttle.isBlocked());
+    CHECK(throttle.acknowledge(3));
+    CHECK(!throttle.isBlocked());
+}